@@ -0,0 +1,122 @@
+/**
+ * @file big_int_bench.cpp
+ * @brief BigInt multiply, divide, toString and parse from 10 to 1,000,000 digits
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Times an n-digit by n-digit multiplication, a 2n-digit by n-digit
+ * division, toString() of an n-digit value and parsing it back, for n
+ * from 10 to the maximum digit count (default 10^6). Besides every power
+ * of ten it measures just below and just above each size at which
+ * big_int.cpp switches algorithm, so the crossovers can be checked:
+ * Karatsuba from 48 limbs, the NTT from 1500 limbs and the Newton
+ * reciprocal from 1000 limbs of divisor and quotient. A limb holds 32
+ * bits, about 9.6 digits. The algorithm column names the multiplication
+ * and division the size selects. Each figure is the best of several runs,
+ * repeated until at least 50 ms have passed.
+ *
+ * Compile it with -O2 -pthread -Icpp_library together with every source
+ * file in cpp_library; bench/run_benchmarks.sh does this. Arguments:
+ * ```
+ * big_int_bench [max digits, default 1000000]
+ * ```
+ */
+
+#include "big_int.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using MathUtils::BigInt;
+
+    // Algorithm thresholds of big_int.cpp, in limbs
+    constexpr std::size_t kKaratsubaLimbs = 48;
+    constexpr std::size_t kNttLimbs = 1500;
+    constexpr std::size_t kNewtonLimbs = 1000;
+
+    const double kDigitsPerLimb = 32 * std::log10(2.0);
+
+    std::size_t digitsOf(double limbs) {
+        return static_cast<std::size_t>(limbs * kDigitsPerLimb);
+    }
+
+    std::string randomDigits(std::size_t count, std::mt19937_64& rng) {
+        std::string digits(count, '0');
+        for (char& digit : digits) {
+            digit = static_cast<char>('0' + rng() % 10);
+        }
+        digits[0] = static_cast<char>('1' + rng() % 9);
+        return digits;
+    }
+
+    // Best microseconds per call of `operation`
+    template <typename Operation>
+    double microseconds(Operation operation) {
+        using Clock = std::chrono::steady_clock;
+        double best = 1e300;
+        const auto deadline = Clock::now() + std::chrono::milliseconds(50);
+        int runs = 0;
+        do {
+            const auto start = Clock::now();
+            operation();
+            best = std::min(best, std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        } while (++runs < 3 || Clock::now() < deadline);
+        return best;
+    }
+
+    const char* multiplication(std::size_t limbs) {
+        return limbs < kKaratsubaLimbs ? "schoolbook" : limbs < kNttLimbs ? "Karatsuba" : "NTT";
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t maxDigits = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t digits = 10; digits <= maxDigits; digits *= 10) {
+        sizes.push_back(digits);
+    }
+    for (std::size_t limbs : {kKaratsubaLimbs, kNewtonLimbs, kNttLimbs}) {
+        sizes.push_back(digitsOf(limbs * 0.9));
+        sizes.push_back(digitsOf(limbs * 1.1));
+    }
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+    sizes.erase(std::remove_if(sizes.begin(), sizes.end(), [maxDigits](std::size_t n) { return n > maxDigits; }),
+                sizes.end());
+
+    std::mt19937_64 rng(20);
+    std::printf("%9s %7s %-18s %12s %12s %12s %12s   (microseconds)\n", "digits", "limbs", "algorithm", "multiply",
+                "divide", "toString", "parse");
+    for (std::size_t n : sizes) {
+        const std::string text = randomDigits(n, rng);
+        const BigInt a(text);
+        const BigInt b(randomDigits(n, rng));
+        const BigInt dividend(randomDigits(2 * n, rng));
+        const std::size_t limbs = a.limbs().size();
+
+        BigInt product;
+        BigInt quotient;
+        std::string printed;
+        BigInt parsed;
+        const double multiplyTime = microseconds([&] { product = a * b; });
+        const double divideTime = microseconds([&] { quotient = dividend / b; });
+        const double toStringTime = microseconds([&] { printed = a.toString(); });
+        const double parseTime = microseconds([&] { parsed = BigInt(text); });
+
+        char algorithm[32];
+        std::snprintf(algorithm, sizeof(algorithm), "%s/%s", multiplication(limbs),
+                      limbs < kNewtonLimbs ? "Knuth" : "Newton");
+        std::printf("%9zu %7zu %-18s %12.2f %12.2f %12.2f %12.2f%s\n", n, limbs, algorithm, multiplyTime, divideTime,
+                    toStringTime, parseTime, printed == text && parsed == a ? "" : "  WRONG");
+    }
+    return 0;
+}
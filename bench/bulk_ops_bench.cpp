@@ -0,0 +1,121 @@
+/**
+ * @file bulk_ops_bench.cpp
+ * @brief Throughput of the span overloads of MathUtils arithmetic against a scalar loop
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * For add, subtract, multiply and divide, in the array-array and the
+ * array-scalar form, times a loop calling the scalar MathUtils function
+ * per element and one call of the span overload, and prints millions of
+ * elements per second for both. Each figure is the best of several
+ * repetitions. The span overloads run at the level
+ * MathUtils::simd::activeLevel() picks, printed first; set
+ * CALCULATOR_SIMD to compare levels.
+ *
+ * Compile it with -O2 -pthread -Icpp_library together with every source
+ * file in cpp_library; bench/run_benchmarks.sh does this. Arguments:
+ * ```
+ * bulk_ops_bench [elements, default 8192] [passes per repetition, default 2000]
+ * ```
+ */
+
+#include "calculator.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    // Best elements per second of `passes` calls of `pass` over `n` elements
+    template <typename Pass>
+    double throughput(std::size_t n, int passes, Pass pass) {
+        double best = 0.0;
+        for (int repetition = 0; repetition < 5; ++repetition) {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < passes; ++i) {
+                pass();
+            }
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = std::max(best, static_cast<double>(n) * passes / seconds);
+        }
+        return best;
+    }
+
+    void report(const char* name, double scalar, double bulk) {
+        std::printf("%-18s %9.0f %9.0f %7.1fx\n", name, scalar / 1e6, bulk / 1e6, bulk / scalar);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = std::max<std::size_t>(1, argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8192);
+    const int passes = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    std::vector<double> a(n);
+    std::vector<double> b(n);
+    std::vector<double> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = 1.0 + static_cast<double>(i % 97) * 0.25;
+        b[i] = 2.0 + static_cast<double>(i % 89) * 0.5;
+    }
+    const double scalar = 1.0625;
+
+    std::printf("simd level: %s, %zu elements\n", MathUtils::simd::toString(MathUtils::simd::activeLevel()), n);
+    std::printf("%-18s %9s %9s %8s\n", "Melem/s", "scalar", "span", "speedup");
+
+    report("add array", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::add(a[i], b[i]);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::add(a, b, out); }));
+    report("add scalar", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::add(a[i], scalar);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::add(a, scalar, out); }));
+    report("subtract array", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::subtract(a[i], b[i]);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::subtract(a, b, out); }));
+    report("subtract scalar", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::subtract(a[i], scalar);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::subtract(a, scalar, out); }));
+    report("multiply array", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::multiply(a[i], b[i]);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::multiply(a, b, out); }));
+    report("multiply scalar", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::multiply(a[i], scalar);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::multiply(a, scalar, out); }));
+    report("divide array", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::divide(a[i], b[i]);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::divide(a, b, out); }));
+    report("divide scalar", throughput(n, passes, [&] {
+               for (std::size_t i = 0; i < n; ++i) {
+                   out[i] = MathUtils::divide(a[i], scalar);
+               }
+           }),
+           throughput(n, passes, [&] { MathUtils::divide(a, scalar, out); }));
+
+    // Keeps the last result observable
+    std::printf("checksum %g\n", out[n / 2]);
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file header_only_bench.cpp
+ * @brief Call overhead of a chained Calculator loop, inline against out of line
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Runs Calculator(x).add(a).multiply(b).subtract(c).divide(d) over an
+ * array, and prints nanoseconds per chain for three loops:
+ * - inline: the library as built, where the arithmetic members are
+ *   constexpr in calculator.h and inline into the loop;
+ * - out of line: the same chain through functions the compiler may not
+ *   inline, which is what every step cost when the members lived in
+ *   calculator.cpp;
+ * - dependent: each chain starts from the previous result, so the loop
+ *   is bound by the latency of the operations rather than by calls.
+ * It also times toString(), which calculator_inline.h defines out of line
+ * by default and inline under CALCULATOR_HEADER_ONLY. The mode the
+ * program was built in is printed first; bench/run_benchmarks.sh builds
+ * and runs it in both.
+ *
+ * Compile it with -O2 -pthread -Icpp_library, optionally
+ * -DCALCULATOR_HEADER_ONLY, together with every source file in
+ * cpp_library. Arguments:
+ * ```
+ * header_only_bench [elements, default 4096] [passes per repetition, default 5000]
+ * ```
+ */
+
+#include "calculator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    // The chain as separate calls the optimizer must keep
+    [[gnu::noinline]] Calculator& addCall(Calculator& calc, double value) {
+        return calc.add(value);
+    }
+
+    [[gnu::noinline]] Calculator& multiplyCall(Calculator& calc, double value) {
+        return calc.multiply(value);
+    }
+
+    [[gnu::noinline]] Calculator& subtractCall(Calculator& calc, double value) {
+        return calc.subtract(value);
+    }
+
+    [[gnu::noinline]] Calculator& divideCall(Calculator& calc, double value) {
+        return calc.divide(value);
+    }
+
+    // Best nanoseconds per element of `passes` calls of `pass`
+    template <typename Pass>
+    double nanoseconds(std::size_t n, int passes, Pass pass) {
+        double best = 1e300;
+        for (int repetition = 0; repetition < 5; ++repetition) {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < passes; ++i) {
+                pass();
+            }
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, seconds * 1e9 / (static_cast<double>(n) * passes));
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = std::max<std::size_t>(1, argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4096);
+    const int passes = argc > 2 ? std::atoi(argv[2]) : 5000;
+
+    std::vector<double> x(n);
+    std::vector<double> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = 1.0 + static_cast<double>(i % 101) * 0.125;
+    }
+    const double a = 0.5;
+    const double b = 1.0009765625;
+    const double c = 0.25;
+    const double d = 1.0625;
+
+#ifdef CALCULATOR_HEADER_ONLY
+    std::printf("mode: header-only, %zu elements\n", n);
+#else
+    std::printf("mode: default, %zu elements\n", n);
+#endif
+
+    const double inlined = nanoseconds(n, passes, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = Calculator(x[i]).add(a).multiply(b).subtract(c).divide(d).getValue();
+        }
+    });
+    const double called = nanoseconds(n, passes, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            Calculator calc(x[i]);
+            divideCall(subtractCall(multiplyCall(addCall(calc, a), b), c), d);
+            out[i] = calc.getValue();
+        }
+    });
+    double carried = 1.0;
+    const double dependent = nanoseconds(n, passes, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            carried = Calculator(carried).add(a).multiply(b).subtract(c).divide(d).getValue();
+        }
+    });
+    std::size_t length = 0;
+    const double formatted = nanoseconds(n, std::max(1, passes / 50), [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            length += Calculator(x[i]).toString(4).size();
+        }
+    });
+
+    std::printf("inline chain       %7.2f ns/chain\n", inlined);
+    std::printf("out-of-line chain  %7.2f ns/chain  (%.1fx the inline chain)\n", called, called / inlined);
+    std::printf("dependent chain    %7.2f ns/chain\n", dependent);
+    std::printf("toString(4)        %7.2f ns/value\n", formatted);
+    std::printf("checksum %g %g %zu\n", out[n / 2], carried, length);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file reduction_bench.cpp
+ * @brief Overhead of the reproducible sum() and dot() against a naive parallel reduction
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Times a naive parallel sum and dot product, which split the input into
+ * one contiguous chunk per thread and add the partial results, against
+ * MathUtils::sum() and MathUtils::dot() in each Accumulation mode, at 1,
+ * 2, 4, ... up to the maximum thread count. It prints milliseconds per
+ * call, the best of several repetitions, and whether each result has the
+ * same bits as the 1-thread result; the naive reduction is expected not
+ * to for most inputs.
+ *
+ * Compile it with -O2 -pthread -Icpp_library together with every source
+ * file in cpp_library; bench/run_benchmarks.sh does this. Arguments:
+ * ```
+ * reduction_bench [elements, default 16777216] [max threads, default hardware concurrency, at least 4]
+ * ```
+ */
+
+#include "reduction.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace {
+    // One contiguous chunk per thread, partial results added in thread order
+    template <typename Partial>
+    double naive(std::size_t n, unsigned threads, Partial partial) {
+        std::vector<double> partials(threads);
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] { partials[t] = partial(n * t / threads, n * (t + 1) / threads); });
+        }
+        for (std::thread& thread : pool) {
+            thread.join();
+        }
+        double total = 0.0;
+        for (double value : partials) {
+            total += value;
+        }
+        return total;
+    }
+
+    // Best milliseconds per call of `reduce`, and its last result
+    template <typename Reduce>
+    double milliseconds(Reduce reduce, double& result) {
+        double best = 1e300;
+        for (int repetition = 0; repetition < 5; ++repetition) {
+            const auto start = std::chrono::steady_clock::now();
+            result = reduce();
+            best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                                      .count());
+        }
+        return best;
+    }
+
+    bool same(double a, double b) {
+        return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b);
+    }
+
+    struct Row {
+        const char* name;
+        double reference = 0.0; ///< 1-thread result
+    };
+
+    void report(Row& row, unsigned threads, double time, double result) {
+        if (threads == 1) {
+            row.reference = result;
+        }
+        std::printf("  %-16s %9.2f ms  %s\n", row.name, time, same(result, row.reference) ? "same bits" : "DIFFERENT");
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 24;
+    const unsigned maxThreads =
+        argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : std::max(4u, std::thread::hardware_concurrency());
+
+    // Mixed signs and magnitudes, so the order of additions shows in the bits
+    std::mt19937_64 rng(17);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-20, 20);
+    std::vector<double> a(n);
+    std::vector<double> b(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = std::ldexp(mantissa(rng), exponent(rng));
+        b[i] = std::ldexp(mantissa(rng), exponent(rng));
+    }
+
+    using MathUtils::Accumulation;
+    Row rows[] = {{"naive sum"},          {"sum Blocked"}, {"sum Compensated"}, {"sum Exact"},
+                  {"naive dot"},          {"dot Blocked"}, {"dot Compensated"}, {"dot Exact"}};
+    const Accumulation modes[] = {Accumulation::Blocked, Accumulation::Compensated, Accumulation::Exact};
+
+    std::printf("%zu elements, hardware threads: %u\n", n, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        std::printf("threads %u\n", threads);
+        double result = 0.0;
+
+        double time = milliseconds([&] {
+            return naive(n, threads, [&](std::size_t begin, std::size_t end) {
+                double partial = 0.0;
+                for (std::size_t i = begin; i < end; ++i) {
+                    partial += a[i];
+                }
+                return partial;
+            });
+        }, result);
+        report(rows[0], threads, time, result);
+        for (int m = 0; m < 3; ++m) {
+            time = milliseconds([&] { return MathUtils::sum(a, {.accumulation = modes[m], .threads = threads}); },
+                                result);
+            report(rows[1 + m], threads, time, result);
+        }
+
+        time = milliseconds([&] {
+            return naive(n, threads, [&](std::size_t begin, std::size_t end) {
+                double partial = 0.0;
+                for (std::size_t i = begin; i < end; ++i) {
+                    partial += a[i] * b[i];
+                }
+                return partial;
+            });
+        }, result);
+        report(rows[4], threads, time, result);
+        for (int m = 0; m < 3; ++m) {
+            time = milliseconds([&] { return MathUtils::dot(a, b, {.accumulation = modes[m], .threads = threads}); },
+                                result);
+            report(rows[5 + m], threads, time, result);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Builds every benchmark against the library and runs it with its default
+# arguments at the SIMD level CALCULATOR_SIMD selects (default: detected).
+#
+#   bench/run_benchmarks.sh [build directory, default _bench_build] [benchmark name ...]
+#
+# CXX and CXXFLAGS are honoured; CXXFLAGS defaults to -O2 so the numbers
+# match a release build without -march=native. -ffp-contract=off is always
+# appended, as the library requires for Calculator to match Program.
+# header_only_bench is built and run twice: by default and with
+# -DCALCULATOR_HEADER_ONLY.
+set -eu
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+build=${1:-_bench_build}
+[ $# -gt 0 ] && shift
+cxx=${CXX:-g++}
+flags="${CXXFLAGS:--O2} -ffp-contract=off"
+mkdir -p "$build"
+
+if [ $# -eq 0 ]; then
+    set -- $(cd "$root/bench" && ls *.cpp | sed 's/\.cpp$//')
+fi
+build_and_run() { # name, output name, extra flags
+    $cxx -std=c++23 $flags $3 -pthread -I"$root/cpp_library" "$root/bench/$1.cpp" "$root"/cpp_library/*.cpp \
+        -o "$build/$2"
+    "$build/$2"
+}
+
+for name in "$@"; do
+    echo "== $name"
+    build_and_run "$name" "$name" ""
+    if [ "$name" = header_only_bench ]; then
+        echo "== $name -DCALCULATOR_HEADER_ONLY"
+        build_and_run "$name" "$name-header-only" -DCALCULATOR_HEADER_ONLY
+    fi
+done
@@ -0,0 +1,99 @@
+/**
+ * @file to_chars_bench.cpp
+ * @brief Cost of formatting a Calculator value: ostringstream, toString() and toChars()
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Formats the same values three ways and prints nanoseconds per value:
+ * the std::ostringstream with std::fixed and std::setprecision that
+ * toString() used to be, the current toString(), and toChars() into a
+ * reused buffer. The values span small amounts, large amounts and
+ * fractions, like a report column. Each figure is the best of several
+ * repetitions, and every result is checked against the ostringstream
+ * text.
+ *
+ * Compile it with -O2 -pthread -Icpp_library together with every source
+ * file in cpp_library; bench/run_benchmarks.sh does this. Arguments:
+ * ```
+ * to_chars_bench [values, default 100000] [precision, default 2]
+ * ```
+ */
+
+#include "calculator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+    // toString() before it was built on toChars()
+    std::string streamed(double value, int precision) {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(precision) << value;
+        return oss.str();
+    }
+
+    // Best nanoseconds per value of `format` over all values
+    template <typename Format>
+    double nanosecondsPerValue(std::size_t count, Format format) {
+        double best = 1e300;
+        for (int repetition = 0; repetition < 5; ++repetition) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < count; ++i) {
+                format(i);
+            }
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, seconds * 1e9 / static_cast<double>(count));
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t count = std::max<std::size_t>(1, argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000);
+    const int precision = argc > 2 ? std::atoi(argv[2]) : 2;
+
+    std::mt19937_64 rng(8);
+    std::uniform_real_distribution<double> fraction(0.0, 1.0);
+    std::vector<Calculator> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const double magnitude = (i % 3 == 0) ? 1e6 : (i % 3 == 1) ? 100.0 : 1.0;
+        values.emplace_back((fraction(rng) - 0.5) * magnitude);
+    }
+
+    std::size_t mismatches = 0;
+    char buffer[512];
+    for (const Calculator& value : values) {
+        const auto [end, ec] = value.toChars(buffer, buffer + sizeof(buffer), precision);
+        const std::string expected = streamed(value.getValue(), precision);
+        mismatches += ec != std::errc() || std::string_view(buffer, end - buffer) != expected ||
+                      value.toString(precision) != expected;
+    }
+
+    std::size_t sink = 0;
+    const double stream = nanosecondsPerValue(count, [&](std::size_t i) {
+        sink += streamed(values[i].getValue(), precision).size();
+    });
+    const double string = nanosecondsPerValue(count, [&](std::size_t i) {
+        sink += values[i].toString(precision).size();
+    });
+    const double chars = nanosecondsPerValue(count, [&](std::size_t i) {
+        sink += static_cast<std::size_t>(values[i].toChars(buffer, buffer + sizeof(buffer), precision).ptr - buffer);
+    });
+
+    std::printf("%zu values, precision %d, %zu mismatches\n", count, precision, mismatches);
+    std::printf("ostringstream %7.1f ns/value\n", stream);
+    std::printf("toString      %7.1f ns/value\n", string);
+    std::printf("toChars       %7.1f ns/value\n", chars);
+    std::printf("checksum %zu\n", sink);
+    return mismatches == 0 ? 0 : 1;
+}
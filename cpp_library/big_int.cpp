@@ -0,0 +1,883 @@
+/**
+ * @file big_int.cpp
+ * @brief Implementation of BigInt and its multiplication and division algorithms
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "big_int.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using MathUtils::BigInt;
+
+namespace {
+    using Limb = BigInt::Limb;
+    using Limbs = std::vector<Limb>;
+    using LimbSpan = std::span<const Limb>;
+
+    constexpr unsigned kLimbBits = 32;
+    constexpr std::uint64_t kLimbBase = std::uint64_t(1) << kLimbBits;
+
+    // Algorithm crossovers, in limbs of the smaller operand (multiplication)
+    // or of the divisor and quotient (division). Measured on x86-64; the
+    // results do not depend on them.
+    constexpr std::size_t kKaratsubaThreshold = 48;
+    constexpr std::size_t kNttThreshold = 1500;
+    constexpr std::size_t kNewtonThreshold = 1000;
+
+    // Decimal conversion works in chunks of 9 digits (10^9 fits a limb) and
+    // switches to divide and conquer above this many limbs
+    constexpr std::uint32_t kDecimalChunk = 1'000'000'000;
+    constexpr std::size_t kDecimalChunkDigits = 9;
+    constexpr std::size_t kDecimalSplitThreshold = 60;
+
+    LimbSpan trimmed(LimbSpan a) {
+        while (!a.empty() && a.back() == 0) {
+            a = a.first(a.size() - 1);
+        }
+        return a;
+    }
+
+    void trim(Limbs& a) {
+        while (!a.empty() && a.back() == 0) {
+            a.pop_back();
+        }
+    }
+
+    int compareMagnitude(LimbSpan a, LimbSpan b) {
+        if (a.size() != b.size()) {
+            return a.size() < b.size() ? -1 : 1;
+        }
+        for (std::size_t i = a.size(); i-- > 0;) {
+            if (a[i] != b[i]) {
+                return a[i] < b[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    Limbs addMagnitude(LimbSpan a, LimbSpan b) {
+        if (a.size() < b.size()) {
+            std::swap(a, b);
+        }
+        Limbs sum(a.size() + 1);
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            carry += std::uint64_t(a[i]) + (i < b.size() ? b[i] : 0);
+            sum[i] = static_cast<Limb>(carry);
+            carry >>= kLimbBits;
+        }
+        sum[a.size()] = static_cast<Limb>(carry);
+        trim(sum);
+        return sum;
+    }
+
+    // a - b for |a| >= |b|
+    Limbs subtractMagnitude(LimbSpan a, LimbSpan b) {
+        Limbs difference(a.size());
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            std::int64_t t = std::int64_t(a[i]) - (i < b.size() ? b[i] : 0) - borrow;
+            borrow = t < 0;
+            difference[i] = static_cast<Limb>(t);
+        }
+        trim(difference);
+        return difference;
+    }
+
+    // out[offset...] += a, with the carry rippling as far as needed
+    void addInto(Limbs& out, LimbSpan a, std::size_t offset) {
+        std::uint64_t carry = 0;
+        std::size_t i = 0;
+        for (; i < a.size(); ++i) {
+            carry += std::uint64_t(out[offset + i]) + a[i];
+            out[offset + i] = static_cast<Limb>(carry);
+            carry >>= kLimbBits;
+        }
+        for (std::size_t j = offset + i; carry != 0; ++j) {
+            carry += out[j];
+            out[j] = static_cast<Limb>(carry);
+            carry >>= kLimbBits;
+        }
+    }
+
+    std::size_t magnitudeBits(LimbSpan a) {
+        return a.empty() ? 0 : kLimbBits * a.size() - std::countl_zero(a.back());
+    }
+
+    // Number of trailing zero bits of a nonzero magnitude
+    std::size_t trailingZeroBits(LimbSpan a) {
+        std::size_t limbs = 0;
+        while (a[limbs] == 0) {
+            ++limbs;
+        }
+        return kLimbBits * limbs + std::countr_zero(a[limbs]);
+    }
+
+    // a >>= bits in place
+    void shiftRightInPlace(Limbs& a, std::size_t bits) {
+        const std::size_t limbs = std::min(bits / kLimbBits, a.size());
+        const unsigned shift = bits % kLimbBits;
+        for (std::size_t i = 0; i + limbs < a.size(); ++i) {
+            std::uint64_t wide = a[i + limbs];
+            if (i + limbs + 1 < a.size()) {
+                wide |= std::uint64_t(a[i + limbs + 1]) << kLimbBits;
+            }
+            a[i] = static_cast<Limb>(wide >> shift);
+        }
+        a.resize(a.size() - limbs);
+        trim(a);
+    }
+
+    // The 64 bits of a from bit `position` up, zero past the end
+    std::uint64_t bitsAt(LimbSpan a, std::size_t position) {
+        const std::size_t limb = position / kLimbBits;
+        const unsigned shift = position % kLimbBits;
+        auto at = [&](std::size_t i) { return i < a.size() ? std::uint64_t(a[i]) : 0; };
+        std::uint64_t word = (at(limb) | at(limb + 1) << kLimbBits) >> shift;
+        return shift == 0 ? word : word | at(limb + 2) << (2 * kLimbBits - shift);
+    }
+
+    // |x f + y g| / 2^bits, for |f| + |g| <= 2^31 and x f + y g divisible by
+    // 2^bits. Every partial sum then fits in std::int64_t.
+    Limbs combineShifted(LimbSpan x, LimbSpan y, std::int64_t f, std::int64_t g, unsigned bits) {
+        const std::size_t n = std::max(x.size(), y.size());
+        Limbs out(n + 1);
+        std::int64_t carry = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::int64_t t = carry + (i < x.size() ? std::int64_t(x[i]) : 0) * f +
+                             (i < y.size() ? std::int64_t(y[i]) : 0) * g;
+            out[i] = static_cast<Limb>(t);
+            carry = t >> kLimbBits;
+        }
+        out[n] = static_cast<Limb>(carry);
+        if (carry < 0) {
+            // Two's complement negation
+            std::uint64_t c = 1;
+            for (Limb& limb : out) {
+                c += static_cast<Limb>(~limb);
+                limb = static_cast<Limb>(c);
+                c >>= kLimbBits;
+            }
+        }
+        shiftRightInPlace(out, bits);
+        return out;
+    }
+
+    // Value of a magnitude of at most two limbs
+    std::uint64_t toWord(LimbSpan a) {
+        std::uint64_t word = 0;
+        for (std::size_t i = a.size(); i-- > 0;) {
+            word = (word << kLimbBits) | a[i];
+        }
+        return word;
+    }
+
+    // Multiplication. Every function returns a trimmed product.
+
+    Limbs multiply(LimbSpan a, LimbSpan b);
+
+    Limbs multiplySchoolbook(LimbSpan a, LimbSpan b) {
+        Limbs product(a.size() + b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            std::uint64_t carry = 0;
+            const std::uint64_t ai = a[i];
+            for (std::size_t j = 0; j < b.size(); ++j) {
+                carry += ai * b[j] + product[i + j];
+                product[i + j] = static_cast<Limb>(carry);
+                carry >>= kLimbBits;
+            }
+            product[i + b.size()] = static_cast<Limb>(carry);
+        }
+        trim(product);
+        return product;
+    }
+
+    // a * b = a1 b1 B^2 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) B + a0 b0,
+    // with B = 2^(32 h); needs b longer than h limbs, see multiply()
+    Limbs multiplyKaratsuba(LimbSpan a, LimbSpan b) {
+        const std::size_t h = a.size() / 2;
+        LimbSpan a0 = trimmed(a.first(h));
+        LimbSpan a1 = a.subspan(h);
+        LimbSpan b0 = trimmed(b.first(h));
+        LimbSpan b1 = b.subspan(h);
+
+        Limbs low = multiply(a0, b0);
+        Limbs high = multiply(a1, b1);
+        Limbs a_sum = addMagnitude(a0, a1);
+        Limbs b_sum = addMagnitude(b0, b1);
+        Limbs middle = multiply(a_sum, b_sum);
+        middle = subtractMagnitude(middle, low);
+        middle = subtractMagnitude(middle, high);
+
+        Limbs product(a.size() + b.size() + 1);
+        std::copy(low.begin(), low.end(), product.begin());
+        addInto(product, high, 2 * h);
+        addInto(product, middle, h);
+        trim(product);
+        return product;
+    }
+
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 UInt128;
+
+    // Number-theoretic transform modulo one NTT-friendly prime P = c 2^k + 1
+    // with primitive root G
+    template <std::uint32_t P, std::uint32_t G>
+    struct Ntt {
+        static std::uint32_t mul(std::uint32_t a, std::uint32_t b) {
+            return static_cast<std::uint32_t>(std::uint64_t(a) * b % P);
+        }
+
+        static std::uint32_t power(std::uint32_t base, std::uint64_t exponent) {
+            std::uint32_t result = 1;
+            for (; exponent != 0; exponent >>= 1) {
+                if (exponent & 1) {
+                    result = mul(result, base);
+                }
+                base = mul(base, base);
+            }
+            return result;
+        }
+
+        static void transform(std::vector<std::uint32_t>& a, bool inverse) {
+            const std::size_t n = a.size();
+            for (std::size_t i = 1, j = 0; i < n; ++i) {
+                std::size_t bit = n >> 1;
+                for (; j & bit; bit >>= 1) {
+                    j ^= bit;
+                }
+                j ^= bit;
+                if (i < j) {
+                    std::swap(a[i], a[j]);
+                }
+            }
+            std::vector<std::uint32_t> twiddles(n / 2);
+            for (std::size_t length = 2; length <= n; length <<= 1) {
+                const std::size_t half = length / 2;
+                std::uint32_t root = power(G, (P - 1) / length);
+                if (inverse) {
+                    root = power(root, P - 2);
+                }
+                twiddles[0] = 1;
+                for (std::size_t j = 1; j < half; ++j) {
+                    twiddles[j] = mul(twiddles[j - 1], root);
+                }
+                for (std::size_t i = 0; i < n; i += length) {
+                    for (std::size_t j = 0; j < half; ++j) {
+                        std::uint32_t u = a[i + j];
+                        std::uint32_t v = mul(a[i + j + half], twiddles[j]);
+                        a[i + j] = u + v >= P ? u + v - P : u + v;
+                        a[i + j + half] = u >= v ? u - v : u + P - v;
+                    }
+                }
+            }
+            if (inverse) {
+                const std::uint32_t scale = power(static_cast<std::uint32_t>(n % P), P - 2);
+                for (std::uint32_t& x : a) {
+                    x = mul(x, scale);
+                }
+            }
+        }
+
+        // Cyclic convolution of a and b modulo P, n a power of two
+        static std::vector<std::uint32_t> convolve(LimbSpan a, LimbSpan b, std::size_t n) {
+            std::vector<std::uint32_t> fa(n), fb(n);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                fa[i] = a[i] % P;
+            }
+            for (std::size_t i = 0; i < b.size(); ++i) {
+                fb[i] = b[i] % P;
+            }
+            transform(fa, false);
+            transform(fb, false);
+            for (std::size_t i = 0; i < n; ++i) {
+                fa[i] = mul(fa[i], fb[i]);
+            }
+            transform(fa, true);
+            return fa;
+        }
+    };
+
+    using Ntt0 = Ntt<998'244'353, 3>;   // 119 * 2^23 + 1
+    using Ntt1 = Ntt<167'772'161, 3>;   // 5 * 2^25 + 1
+    using Ntt2 = Ntt<469'762'049, 3>;   // 7 * 2^26 + 1
+
+    // Longest product the three primes can carry: 2^23 points, and every
+    // coefficient (at most 2^22 limb products below 2^64) stays below
+    // P0 P1 P2 > 2^86
+    constexpr std::size_t kMaxNttLength = std::size_t(1) << 23;
+
+    // Convolution modulo three primes, recombined with Garner's CRT
+    Limbs multiplyNtt(LimbSpan a, LimbSpan b) {
+        constexpr std::uint64_t p0 = 998'244'353;
+        constexpr std::uint64_t p1 = 167'772'161;
+        constexpr std::uint64_t p2 = 469'762'049;
+        const std::uint32_t p0_inverse_mod_p1 = Ntt1::power(p0 % p1, p1 - 2);
+        const std::uint32_t p01_inverse_mod_p2 = Ntt2::power(static_cast<std::uint32_t>(p0 * p1 % p2), p2 - 2);
+
+        const std::size_t length = a.size() + b.size() - 1;
+        const std::size_t n = std::bit_ceil(length);
+        std::vector<std::uint32_t> r0 = Ntt0::convolve(a, b, n);
+        std::vector<std::uint32_t> r1 = Ntt1::convolve(a, b, n);
+        std::vector<std::uint32_t> r2 = Ntt2::convolve(a, b, n);
+
+        Limbs product(a.size() + b.size());
+        UInt128 carry = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            std::uint64_t x0 = r0[i];
+            std::uint64_t k1 = (r1[i] + p1 - x0 % p1) % p1 * p0_inverse_mod_p1 % p1;
+            std::uint64_t x01 = x0 + p0 * k1; // below p0 p1 < 2^58
+            std::uint64_t k2 = (r2[i] + p2 - x01 % p2) % p2 * p01_inverse_mod_p2 % p2;
+            carry += x01 + UInt128(p0 * p1) * k2;
+            product[i] = static_cast<Limb>(carry);
+            carry >>= kLimbBits;
+        }
+        for (std::size_t i = length; carry != 0; ++i) {
+            product[i] = static_cast<Limb>(carry);
+            carry >>= kLimbBits;
+        }
+        trim(product);
+        return product;
+    }
+#endif
+
+    Limbs multiply(LimbSpan a, LimbSpan b) {
+        a = trimmed(a);
+        b = trimmed(b);
+        if (a.size() < b.size()) {
+            std::swap(a, b);
+        }
+        if (b.empty()) {
+            return {};
+        }
+        if (b.size() < kKaratsubaThreshold) {
+            return multiplySchoolbook(a, b);
+        }
+#ifdef __SIZEOF_INT128__
+        if (b.size() >= kNttThreshold && a.size() + b.size() <= kMaxNttLength) {
+            return multiplyNtt(a, b);
+        }
+#endif
+        if (2 * b.size() > a.size()) {
+            return multiplyKaratsuba(a, b);
+        }
+        // Unbalanced: multiply b by each b-sized slice of a
+        Limbs product(a.size() + b.size() + 1);
+        for (std::size_t offset = 0; offset < a.size(); offset += b.size()) {
+            LimbSpan slice = a.subspan(offset, std::min(b.size(), a.size() - offset));
+            addInto(product, multiply(slice, b), offset);
+        }
+        trim(product);
+        return product;
+    }
+
+    // Division
+
+    // a / d for a single-limb d; returns the remainder
+    Limb divideByLimb(LimbSpan a, Limb d, Limbs& quotient) {
+        quotient.assign(a.size(), 0);
+        std::uint64_t remainder = 0;
+        for (std::size_t i = a.size(); i-- > 0;) {
+            std::uint64_t current = (remainder << kLimbBits) | a[i];
+            quotient[i] = static_cast<Limb>(current / d);
+            remainder = current % d;
+        }
+        trim(quotient);
+        return static_cast<Limb>(remainder);
+    }
+
+    // Knuth, TAOCP vol. 2, 4.3.1 algorithm D (after Hacker's Delight divmnu).
+    // Needs |a| >= |b| and b of at least two limbs.
+    void divideKnuth(LimbSpan a, LimbSpan b, Limbs& quotient, Limbs& remainder) {
+        const std::size_t n = b.size();
+        const std::size_t m = a.size() - n;
+        const int shift = std::countl_zero(b.back());
+
+        // Normalize so that the top divisor limb has its high bit set
+        Limbs v(n);
+        Limbs u(a.size() + 1);
+        for (std::size_t i = n - 1; i > 0; --i) {
+            v[i] = static_cast<Limb>((b[i] << shift) | (shift ? std::uint64_t(b[i - 1]) >> (kLimbBits - shift) : 0));
+        }
+        v[0] = b[0] << shift;
+        u[a.size()] = shift ? static_cast<Limb>(std::uint64_t(a.back()) >> (kLimbBits - shift)) : 0;
+        for (std::size_t i = a.size() - 1; i > 0; --i) {
+            u[i] = static_cast<Limb>((a[i] << shift) | (shift ? std::uint64_t(a[i - 1]) >> (kLimbBits - shift) : 0));
+        }
+        u[0] = a[0] << shift;
+
+        quotient.assign(m + 1, 0);
+        for (std::size_t j = m + 1; j-- > 0;) {
+            // Estimate the quotient digit from the top two limbs, then
+            // correct it with the third
+            std::uint64_t top = (std::uint64_t(u[j + n]) << kLimbBits) | u[j + n - 1];
+            std::uint64_t qhat = top / v[n - 1];
+            std::uint64_t rhat = top % v[n - 1];
+            while (qhat >= kLimbBase || qhat * v[n - 2] > ((rhat << kLimbBits) | u[j + n - 2])) {
+                --qhat;
+                rhat += v[n - 1];
+                if (rhat >= kLimbBase) {
+                    break;
+                }
+            }
+
+            // u[j .. j + n] -= qhat * v
+            std::int64_t borrow = 0;
+            std::int64_t t = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                std::uint64_t p = qhat * v[i];
+                t = std::int64_t(u[i + j]) - borrow - std::int64_t(p & 0xFFFFFFFF);
+                u[i + j] = static_cast<Limb>(t);
+                borrow = std::int64_t(p >> kLimbBits) - (t >> kLimbBits);
+            }
+            t = std::int64_t(u[j + n]) - borrow;
+            u[j + n] = static_cast<Limb>(t);
+
+            quotient[j] = static_cast<Limb>(qhat);
+            if (t < 0) {
+                // qhat was one too large: add v back
+                --quotient[j];
+                std::uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    carry += std::uint64_t(u[i + j]) + v[i];
+                    u[i + j] = static_cast<Limb>(carry);
+                    carry >>= kLimbBits;
+                }
+                u[j + n] = static_cast<Limb>(u[j + n] + carry);
+            }
+        }
+
+        remainder.assign(n, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            remainder[i] = static_cast<Limb>((u[i] >> shift) | (shift ? std::uint64_t(u[i + 1]) << (kLimbBits - shift) : 0));
+        }
+        trim(quotient);
+        trim(remainder);
+    }
+
+    // Approximates 2^(64 h) / b for b of h limbs by Newton's iteration
+    // x' = x + x (2^(64 h) - b x) / 2^(64 h), starting from the reciprocal
+    // of the top half of b. Each step doubles the correct limbs, so the cost
+    // is a constant number of h-limb multiplications.
+    BigInt reciprocal(LimbSpan b) {
+        const std::size_t h = b.size();
+        if (h <= kNewtonThreshold / 2) {
+            Limbs numerator(2 * h + 1);
+            numerator[2 * h] = 1;
+            Limbs quotient, remainder;
+            divideKnuth(numerator, b, quotient, remainder);
+            return BigInt::fromLimbs(quotient);
+        }
+        // Two guard limbs absorb the truncation of b to its top l limbs
+        const std::size_t l = h / 2 + 2;
+        BigInt y = reciprocal(b.subspan(h - l)) << (kLimbBits * (h - l));
+        BigInt error = (BigInt(1) << (2 * kLimbBits * h)) - BigInt::fromLimbs(b) * y;
+        return y + ((y * error) >> (2 * kLimbBits * h));
+    }
+
+    // Quotient of a < b 2^(32 m) by b of m limbs, from the reciprocal r of b.
+    // The estimate only needs the top m + 1 limbs of a: the rest shifts the
+    // product a r / 2^(64 m) by less than one.
+    void divideWithReciprocal(const BigInt& a, const BigInt& b, const BigInt& r, std::size_t m, BigInt& quotient,
+                              BigInt& remainder) {
+        quotient = ((a >> (kLimbBits * (m - 1))) * r) >> (kLimbBits * (m + 1));
+        remainder = a - quotient * b;
+        // The estimate is off by a few units at most; each pass divides the
+        // leftover error, so this converges in one or two steps
+        while (remainder.isNegative() || remainder >= b) {
+            BigInt step = (remainder * r) >> (2 * kLimbBits * m);
+            if (step.isZero()) {
+                step = remainder.isNegative() ? BigInt(-1) : BigInt(1);
+            }
+            quotient += step;
+            remainder -= step * b;
+        }
+    }
+
+    // Newton division: one reciprocal of b, then a b-sized quotient chunk per
+    // b-sized chunk of a, from the top down
+    void divideNewton(LimbSpan a, LimbSpan b, Limbs& quotient, Limbs& remainder) {
+        const std::size_t m = b.size();
+        const BigInt divisor = BigInt::fromLimbs(b);
+        const BigInt r = reciprocal(b);
+
+        std::size_t chunks = (a.size() + m - 1) / m;
+        BigInt q;
+        BigInt rest;
+        for (std::size_t c = chunks; c-- > 0;) {
+            LimbSpan chunk = a.subspan(c * m, std::min(m, a.size() - c * m));
+            BigInt current = (rest << (kLimbBits * m)) + BigInt::fromLimbs(chunk);
+            BigInt digit;
+            divideWithReciprocal(current, divisor, r, m, digit, rest);
+            q = (q << (kLimbBits * m)) + digit;
+        }
+        quotient.assign(q.limbs().begin(), q.limbs().end());
+        remainder.assign(rest.limbs().begin(), rest.limbs().end());
+    }
+
+    void divideMagnitude(LimbSpan a, LimbSpan b, Limbs& quotient, Limbs& remainder) {
+        if (compareMagnitude(a, b) < 0) {
+            quotient.clear();
+            remainder.assign(a.begin(), a.end());
+            return;
+        }
+        if (b.size() == 1) {
+            Limb rest = divideByLimb(a, b[0], quotient);
+            remainder.clear();
+            if (rest != 0) {
+                remainder.push_back(rest);
+            }
+            return;
+        }
+        if (b.size() < kNewtonThreshold || a.size() - b.size() < kNewtonThreshold) {
+            divideKnuth(a, b, quotient, remainder);
+            return;
+        }
+        divideNewton(a, b, quotient, remainder);
+    }
+
+    // Decimal conversion
+
+    // powers[k] = 10^(9 * 2^k), up to the first power with at least `limbs` limbs / 2
+    std::vector<BigInt> decimalPowers(std::size_t limbs) {
+        std::vector<BigInt> powers{BigInt(kDecimalChunk)};
+        while (2 * powers.back().limbs().size() < limbs) {
+            powers.push_back(powers.back() * powers.back());
+        }
+        return powers;
+    }
+
+    // Appends the digits of value, left-padded with zeros to `width` digits
+    // (no padding for width 0)
+    void appendDigits(const BigInt& value, std::size_t width, const std::vector<BigInt>& powers, std::string& out) {
+        if (value.limbs().size() < kDecimalSplitThreshold) {
+            std::string reversed;
+            Limbs rest(value.limbs().begin(), value.limbs().end());
+            Limbs next;
+            while (!rest.empty()) {
+                Limb chunk = divideByLimb(rest, kDecimalChunk, next);
+                rest.swap(next);
+                for (std::size_t i = 0; i < kDecimalChunkDigits && (chunk != 0 || !rest.empty()); ++i) {
+                    reversed.push_back(static_cast<char>('0' + chunk % 10));
+                    chunk /= 10;
+                }
+            }
+            if (reversed.size() < width) {
+                out.append(width - reversed.size(), '0');
+            }
+            out.append(reversed.rbegin(), reversed.rend());
+            return;
+        }
+        // Split at the largest power with at most half the limbs of value
+        std::size_t k = 0;
+        while (k + 1 < powers.size() && 2 * powers[k + 1].limbs().size() <= value.limbs().size()) {
+            ++k;
+        }
+        BigInt high, low;
+        BigInt::divMod(value, powers[k], high, low);
+        const std::size_t low_width = kDecimalChunkDigits << k;
+        appendDigits(high, width > low_width ? width - low_width : 0, powers, out);
+        appendDigits(low, low_width, powers, out);
+    }
+
+    BigInt parseDigits(std::string_view digits, const std::vector<BigInt>& powers) {
+        if (digits.size() <= kDecimalChunkDigits * kDecimalSplitThreshold) {
+            Limbs value;
+            std::size_t first = digits.size() % kDecimalChunkDigits;
+            if (first == 0) {
+                first = kDecimalChunkDigits;
+            }
+            for (std::size_t begin = 0; begin < digits.size();) {
+                std::uint64_t chunk = 0;
+                std::uint64_t scale = 1;
+                for (std::size_t end = begin + first; begin < end; ++begin) {
+                    chunk = chunk * 10 + static_cast<std::uint64_t>(digits[begin] - '0');
+                    scale *= 10;
+                }
+                first = kDecimalChunkDigits;
+                // value = value * scale + chunk
+                std::uint64_t carry = chunk;
+                for (Limb& limb : value) {
+                    carry += limb * scale;
+                    limb = static_cast<Limb>(carry);
+                    carry >>= kLimbBits;
+                }
+                if (carry != 0) {
+                    value.push_back(static_cast<Limb>(carry));
+                }
+            }
+            return BigInt::fromLimbs(value);
+        }
+        std::size_t k = 0;
+        while (k + 1 < powers.size() && 2 * (kDecimalChunkDigits << (k + 1)) <= digits.size()) {
+            ++k;
+        }
+        const std::size_t low_width = kDecimalChunkDigits << k;
+        BigInt high = parseDigits(digits.substr(0, digits.size() - low_width), powers);
+        BigInt low = parseDigits(digits.substr(digits.size() - low_width), powers);
+        return high * powers[k] + low;
+    }
+}
+
+namespace MathUtils {
+    void BigInt::normalize() {
+        trim(limbs_);
+        if (limbs_.empty()) {
+            negative_ = false;
+        }
+    }
+
+    BigInt::BigInt(std::int64_t value) : negative_(value < 0) {
+        std::uint64_t magnitude = value < 0 ? 0 - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        for (; magnitude != 0; magnitude >>= kLimbBits) {
+            limbs_.push_back(static_cast<Limb>(magnitude));
+        }
+    }
+
+    BigInt::BigInt(std::string_view text) {
+        bool negative = false;
+        if (!text.empty() && (text.front() == '-' || text.front() == '+')) {
+            negative = text.front() == '-';
+            text.remove_prefix(1);
+        }
+        if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            throw std::invalid_argument("Invalid integer literal");
+        }
+        // About 3.32 bits per digit
+        std::vector<BigInt> powers = decimalPowers(text.size() / kDecimalChunkDigits + 1);
+        *this = parseDigits(text, powers);
+        negative_ = negative && !limbs_.empty();
+    }
+
+    BigInt BigInt::fromLimbs(std::span<const Limb> magnitude, bool negative) {
+        BigInt value;
+        value.limbs_.assign(magnitude.begin(), magnitude.end());
+        value.negative_ = negative;
+        value.normalize();
+        return value;
+    }
+
+    std::size_t BigInt::bitLength() const {
+        return magnitudeBits(limbs_);
+    }
+
+    bool BigInt::fitsInt64() const {
+        std::size_t bits = bitLength();
+        return bits < 64 || (bits == 64 && negative_ && limbs_[0] == 0 && limbs_[1] == 0x80000000u);
+    }
+
+    std::int64_t BigInt::toInt64() const {
+        std::uint64_t magnitude = 0;
+        for (std::size_t i = std::min<std::size_t>(limbs_.size(), 2); i-- > 0;) {
+            magnitude = (magnitude << kLimbBits) | limbs_[i];
+        }
+        return negative_ ? static_cast<std::int64_t>(0 - magnitude) : static_cast<std::int64_t>(magnitude);
+    }
+
+    double BigInt::toDouble() const {
+        const std::size_t bits = bitLength();
+        double magnitude = std::numeric_limits<double>::infinity();
+        if (bits <= std::numeric_limits<double>::max_exponent) {
+            // Scale the top 64 bits; the bits below them are truncated
+            const std::size_t shift = bits > 64 ? bits - 64 : 0;
+            const BigInt top = *this >> shift;
+            magnitude = std::ldexp(static_cast<double>(toWord(top.limbs_)), static_cast<int>(shift));
+        }
+        return negative_ ? -magnitude : magnitude;
+    }
+
+    std::string BigInt::toString() const {
+        std::string text;
+        if (negative_) {
+            text.push_back('-');
+        }
+        if (limbs_.empty()) {
+            text.push_back('0');
+            return text;
+        }
+        std::vector<BigInt> powers = decimalPowers(limbs_.size());
+        appendDigits(negative_ ? -*this : *this, 0, powers, text);
+        return text;
+    }
+
+    void BigInt::divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder) {
+        if (b.isZero()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        Limbs q, r;
+        divideMagnitude(a.limbs_, b.limbs_, q, r);
+        quotient = fromLimbs(q, a.negative_ != b.negative_);
+        remainder = fromLimbs(r, a.negative_);
+    }
+
+    BigInt BigInt::gcd(const BigInt& a, const BigInt& b) {
+        Limbs x = a.limbs_;
+        Limbs y = b.limbs_;
+        if (x.empty() || y.empty()) {
+            return fromLimbs(x.empty() ? y : x);
+        }
+        const std::size_t shift = std::min(trailingZeroBits(x), trailingZeroBits(y));
+        shiftRightInPlace(y, trailingZeroBits(y));
+        // The gcd is now odd, so factors of two can be dropped at will; y
+        // stays odd throughout
+        while (!x.empty()) {
+            shiftRightInPlace(x, trailingZeroBits(x));
+            if (compareMagnitude(x, y) < 0) {
+                std::swap(x, y);
+            }
+            const std::size_t bits = magnitudeBits(x);
+            if (bits <= 64) {
+                const std::uint64_t word = binaryGcd(toWord(x), toWord(y));
+                const Limb limbs[] = {static_cast<Limb>(word), static_cast<Limb>(word >> kLimbBits)};
+                return fromLimbs(limbs) << shift;
+            }
+            if (x.size() > y.size() + 1) {
+                Limbs quotient, remainder;
+                divideMagnitude(x, y, quotient, remainder);
+                x = std::move(remainder);
+                continue;
+            }
+            // 31 steps of binary GCD (u odd: u = (u - v) / 2 after ordering;
+            // u even: u = u / 2) run on words made of the low 31 bits and
+            // the top 33 bits of each operand, then apply to the full values
+            // as one linear map. The low bits, and so the parities, are
+            // exact; the top bits keep the comparisons right nearly always,
+            // and a wrong one only costs a sign, fixed by taking |x| and |y|
+            // (Pornin, "Optimized Binary GCD for Modular Inversion", 2020).
+            constexpr unsigned kSteps = 31;
+            constexpr std::uint64_t kLowMask = (std::uint64_t(1) << kSteps) - 1;
+            std::uint64_t u = (bitsAt(x, 0) & kLowMask) | (bitsAt(x, bits - 33) << kSteps);
+            std::uint64_t v = (bitsAt(y, 0) & kLowMask) | (bitsAt(y, bits - 33) << kSteps);
+            std::int64_t f0 = 1, g0 = 0, f1 = 0, g1 = 1;
+            for (unsigned i = 0; i < kSteps; ++i) {
+                if (u & 1) {
+                    if (u < v) {
+                        std::swap(u, v);
+                        std::swap(f0, f1);
+                        std::swap(g0, g1);
+                    }
+                    u -= v;
+                    f0 -= f1;
+                    g0 -= g1;
+                }
+                u >>= 1;
+                f1 *= 2;
+                g1 *= 2;
+            }
+            const std::size_t before = bits + magnitudeBits(y);
+            Limbs next_x = combineShifted(x, y, f0, g0, kSteps);
+            y = combineShifted(x, y, f1, g1, kSteps);
+            x = std::move(next_x);
+            if (!x.empty() && magnitudeBits(x) + magnitudeBits(y) >= before) {
+                // No progress from a run of bad approximations: take one
+                // exact step, which always shrinks the larger operand
+                shiftRightInPlace(x, trailingZeroBits(x));
+                if (compareMagnitude(x, y) < 0) {
+                    std::swap(x, y);
+                }
+                x = subtractMagnitude(x, y);
+            }
+        }
+        return fromLimbs(y) << shift;
+    }
+
+    BigInt BigInt::operator-() const {
+        BigInt negated = *this;
+        negated.negative_ = !negative_ && !limbs_.empty();
+        return negated;
+    }
+
+    BigInt operator+(const BigInt& a, const BigInt& b) {
+        if (a.negative_ == b.negative_) {
+            return BigInt::fromLimbs(addMagnitude(a.limbs_, b.limbs_), a.negative_);
+        }
+        if (compareMagnitude(a.limbs_, b.limbs_) >= 0) {
+            return BigInt::fromLimbs(subtractMagnitude(a.limbs_, b.limbs_), a.negative_);
+        }
+        return BigInt::fromLimbs(subtractMagnitude(b.limbs_, a.limbs_), b.negative_);
+    }
+
+    BigInt operator-(const BigInt& a, const BigInt& b) {
+        return a + (-b);
+    }
+
+    BigInt operator*(const BigInt& a, const BigInt& b) {
+        return BigInt::fromLimbs(multiply(a.limbs_, b.limbs_), a.negative_ != b.negative_);
+    }
+
+    BigInt operator/(const BigInt& a, const BigInt& b) {
+        BigInt quotient, remainder;
+        BigInt::divMod(a, b, quotient, remainder);
+        return quotient;
+    }
+
+    BigInt operator%(const BigInt& a, const BigInt& b) {
+        BigInt quotient, remainder;
+        BigInt::divMod(a, b, quotient, remainder);
+        return remainder;
+    }
+
+    BigInt operator<<(const BigInt& value, std::size_t bits) {
+        if (value.isZero()) {
+            return value;
+        }
+        const std::size_t limbs = bits / kLimbBits;
+        const unsigned shift = bits % kLimbBits;
+        Limbs shifted(value.limbs_.size() + limbs + 1);
+        for (std::size_t i = 0; i < value.limbs_.size(); ++i) {
+            std::uint64_t wide = std::uint64_t(value.limbs_[i]) << shift;
+            shifted[i + limbs] |= static_cast<Limb>(wide);
+            shifted[i + limbs + 1] = static_cast<Limb>(wide >> kLimbBits);
+        }
+        return BigInt::fromLimbs(shifted, value.negative_);
+    }
+
+    BigInt operator>>(const BigInt& value, std::size_t bits) {
+        const std::size_t limbs = bits / kLimbBits;
+        const unsigned shift = bits % kLimbBits;
+        if (limbs >= value.limbs_.size()) {
+            return BigInt();
+        }
+        Limbs shifted(value.limbs_.size() - limbs);
+        for (std::size_t i = 0; i < shifted.size(); ++i) {
+            std::uint64_t wide = value.limbs_[i + limbs];
+            if (i + limbs + 1 < value.limbs_.size()) {
+                wide |= std::uint64_t(value.limbs_[i + limbs + 1]) << kLimbBits;
+            }
+            shifted[i] = static_cast<Limb>(wide >> shift);
+        }
+        return BigInt::fromLimbs(shifted, value.negative_);
+    }
+
+    std::strong_ordering operator<=>(const BigInt& a, const BigInt& b) {
+        if (a.negative_ != b.negative_) {
+            return a.negative_ ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        int magnitude = compareMagnitude(a.limbs_, b.limbs_);
+        if (a.negative_) {
+            magnitude = -magnitude;
+        }
+        return magnitude <=> 0;
+    }
+
+    std::to_chars_result NumericTraits<BigInt>::toChars(char* first, char* last, const BigInt& value,
+                                                        int precision) {
+        std::string digits = value.toString();
+        std::size_t length = digits.size() + (precision > 0 ? 1 + static_cast<std::size_t>(precision) : 0);
+        if (static_cast<std::size_t>(last - first) < length) {
+            return {last, std::errc::value_too_large};
+        }
+        first = std::copy(digits.begin(), digits.end(), first);
+        if (precision > 0) {
+            *first++ = '.';
+            first = std::fill_n(first, precision, '0');
+        }
+        return {first, std::errc()};
+    }
+}
@@ -0,0 +1,263 @@
+/**
+ * @file big_int.h
+ * @brief Arbitrary-precision integers for exact results of any size
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * BigInt is a signed integer of unbounded size, stored as 32-bit limbs.
+ * The cost of an operation grows with the operand size, and the algorithm
+ * is picked by size so that numbers with a million digits stay practical:
+ *
+ * - multiplication: schoolbook, then Karatsuba (O(n^1.58)) from 48 limbs
+ *   and a number-theoretic transform (O(n log n)) from 1500 limbs
+ * - division: Knuth's algorithm D, then a Newton reciprocal from 1000
+ *   limbs, at the cost of a few multiplications
+ * - decimal conversion: 9 digits per step, then divide and conquer on
+ *   powers 10^(9 * 2^k)
+ *
+ * Decimal amounts are exact as integers in their smallest unit (cents,
+ * satoshis, ...). BigIntCalculator (big_int_calculator.h) runs the fluent
+ * API on BigInt; its divide() truncates toward zero like integer division.
+ *
+ * @example
+ * ```cpp
+ * MathUtils::BigInt a("123456789012345678901234567890");
+ * MathUtils::BigInt b = a * a - 1;
+ * std::string digits = (b / 7).toString();
+ * ```
+ */
+
+#ifndef BIG_INT_H
+#define BIG_INT_H
+
+#include "numeric_traits.h"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace MathUtils {
+    /**
+     * @brief Greatest common divisor by Stein's binary algorithm
+     * @param a First value
+     * @param b Second value
+     * @return gcd(a, b); gcd(a, 0) == a
+     *
+     * Only shifts and subtractions, with the powers of two removed by
+     * counting trailing zeros, which beats Euclid's divisions on 64-bit
+     * words.
+     */
+    constexpr std::uint64_t binaryGcd(std::uint64_t a, std::uint64_t b) {
+        if (a == 0 || b == 0) {
+            return a | b;
+        }
+        const int shift = std::countr_zero(a | b);
+        int zeros = std::countr_zero(a);
+        b >>= std::countr_zero(b);
+        // b stays odd; a - b and b - a have the same trailing zeros, so
+        // the next shift does not wait for the comparison
+        while (a != 0) {
+            a >>= zeros;
+            const std::uint64_t difference = a - b;
+            zeros = std::countr_zero(difference);
+            const std::uint64_t smaller = std::min(a, b);
+            a = a > b ? difference : b - a;
+            b = smaller;
+        }
+        return b << shift;
+    }
+
+    /**
+     * @class BigInt
+     * @brief A signed integer of arbitrary size
+     *
+     * Sign and magnitude, with the magnitude in little-endian 32-bit limbs
+     * and no leading zero limbs; zero has no limbs and is never negative.
+     * Division truncates toward zero and the remainder takes the sign of
+     * the dividend, as for built-in integers. Dividing by zero throws
+     * std::invalid_argument.
+     *
+     * Converts implicitly from std::int64_t, which lets it stand in for the
+     * value type of BasicCalculator (see BigIntCalculator).
+     */
+    class BigInt {
+    public:
+        /// One base-2^32 digit of the magnitude
+        using Limb = std::uint32_t;
+
+    private:
+        std::vector<Limb> limbs_; ///< Magnitude, least significant limb first
+        bool negative_ = false;   ///< Sign; false for zero
+
+        void normalize();
+
+    public:
+        /**
+         * @brief Creates zero
+         */
+        BigInt() = default;
+
+        /**
+         * @brief Creates a BigInt equal to a built-in integer
+         * @param value Initial value
+         */
+        BigInt(std::int64_t value);
+
+        /**
+         * @brief Parses a decimal integer
+         * @param text Optional '+' or '-' followed by one or more digits
+         * @throws std::invalid_argument if text is not a decimal integer
+         */
+        explicit BigInt(std::string_view text);
+
+        /**
+         * @brief Creates a BigInt from limbs
+         * @param magnitude Limbs of |value|, least significant first;
+         *        leading zero limbs are allowed
+         * @param negative Sign of the value; ignored for zero
+         * @return The value
+         */
+        static BigInt fromLimbs(std::span<const Limb> magnitude, bool negative = false);
+
+        /**
+         * @brief Gets the limbs of the magnitude
+         * @return Least significant limb first, empty for zero
+         */
+        std::span<const Limb> limbs() const {
+            return limbs_;
+        }
+
+        /**
+         * @brief Checks for zero
+         * @return True if the value is zero
+         */
+        bool isZero() const {
+            return limbs_.empty();
+        }
+
+        /**
+         * @brief Checks the sign
+         * @return True if the value is below zero
+         */
+        bool isNegative() const {
+            return negative_;
+        }
+
+        /**
+         * @brief Gets the number of significant bits of the magnitude
+         * @return 0 for zero, otherwise floor(log2(|value|)) + 1
+         */
+        std::size_t bitLength() const;
+
+        /**
+         * @brief Checks whether the value fits in std::int64_t
+         * @return True if toInt64() is exact
+         */
+        bool fitsInt64() const;
+
+        /**
+         * @brief Converts to std::int64_t
+         * @return The value, which must satisfy fitsInt64()
+         */
+        std::int64_t toInt64() const;
+
+        /**
+         * @brief Converts to the nearest double
+         * @return Value rounded to double (truncated below the top 64 bits),
+         *         or ±infinity if out of range
+         */
+        double toDouble() const;
+
+        /**
+         * @brief Formats as decimal
+         * @return Digits with a leading '-' for negative values
+         */
+        std::string toString() const;
+
+        /**
+         * @brief Divides with quotient and remainder in one pass
+         * @param a Dividend
+         * @param b Divisor
+         * @param quotient Receives a / b, truncated toward zero
+         * @param remainder Receives a - b * quotient
+         * @throws std::invalid_argument if b is zero
+         */
+        static void divMod(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder);
+
+        /**
+         * @brief Greatest common divisor of the magnitudes
+         * @param a First value
+         * @param b Second value
+         * @return gcd(|a|, |b|), never negative; gcd(a, 0) == |a|
+         *
+         * Binary GCD, 31 steps at a time: each batch is worked out on 64-bit
+         * approximations and applied to the full values as one linear
+         * combination. A division step evens out operands of very different
+         * sizes, and binaryGcd() finishes once both fit in 64 bits.
+         * Quadratic in the operand size, with a small constant.
+         */
+        static BigInt gcd(const BigInt& a, const BigInt& b);
+
+        BigInt operator-() const;
+
+        friend BigInt operator+(const BigInt& a, const BigInt& b);
+        friend BigInt operator-(const BigInt& a, const BigInt& b);
+        friend BigInt operator*(const BigInt& a, const BigInt& b);
+        friend BigInt operator/(const BigInt& a, const BigInt& b);
+        friend BigInt operator%(const BigInt& a, const BigInt& b);
+
+        /// Multiplies |value| by 2^bits, keeping the sign
+        friend BigInt operator<<(const BigInt& value, std::size_t bits);
+        /// Divides |value| by 2^bits, truncating toward zero like operator/
+        friend BigInt operator>>(const BigInt& value, std::size_t bits);
+
+        BigInt& operator+=(const BigInt& other) {
+            return *this = *this + other;
+        }
+
+        BigInt& operator-=(const BigInt& other) {
+            return *this = *this - other;
+        }
+
+        BigInt& operator*=(const BigInt& other) {
+            return *this = *this * other;
+        }
+
+        BigInt& operator/=(const BigInt& other) {
+            return *this = *this / other;
+        }
+
+        BigInt& operator%=(const BigInt& other) {
+            return *this = *this % other;
+        }
+
+        friend bool operator==(const BigInt& a, const BigInt& b) = default;
+        friend std::strong_ordering operator<=>(const BigInt& a, const BigInt& b);
+    };
+
+    /**
+     * @brief Numeric rules for BigInt: exact, printed as all its digits
+     *        followed by `precision` zero decimals
+     */
+    template <>
+    struct NumericTraits<BigInt> {
+        static bool isNearZero(const BigInt& b) {
+            return b.isZero();
+        }
+
+        static bool approximatelyEqual(const BigInt& a, const BigInt& b) {
+            return a == b;
+        }
+
+        static std::to_chars_result toChars(char* first, char* last, const BigInt& value, int precision);
+    };
+}
+
+#endif // BIG_INT_H
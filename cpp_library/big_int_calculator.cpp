@@ -0,0 +1,15 @@
+/**
+ * @file big_int_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on arbitrary-precision integers
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "big_int_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::BigInt, MathUtils::ThrowingDivision>;
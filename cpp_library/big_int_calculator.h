@@ -0,0 +1,35 @@
+/**
+ * @file big_int_calculator.h
+ * @brief BasicCalculator on the arbitrary-precision integers of big_int.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Kept out of calculator.h so that code using only Calculator does not
+ * parse BigInt.
+ *
+ * @example
+ * ```cpp
+ * #include "big_int_calculator.h"
+ *
+ * BigIntCalculator factorial(MathUtils::BigInt(1));
+ * for (int i = 2; i <= 30; ++i) {
+ *     factorial.multiply(MathUtils::BigInt(i));
+ * }
+ * ```
+ */
+
+#ifndef BIG_INT_CALCULATOR_H
+#define BIG_INT_CALCULATOR_H
+
+#include "calculator.h"
+#include "big_int.h"
+
+/**
+ * @brief Calculator on exact integers of any size, see big_int.h
+ *
+ * divide() truncates toward zero and throws on a zero divisor.
+ */
+using BigIntCalculator = BasicCalculator<MathUtils::BigInt, MathUtils::ThrowingDivision>;
+
+#endif // BIG_INT_CALCULATOR_H
@@ -7,98 +7,219 @@
  */
 
 #include "calculator.h"
-#include <sstream>
-#include <iomanip>
+#include "simd_dispatch.h"
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
 
 namespace MathUtils {
-    
-    double add(double a, double b) {
-        return a + b;
+    namespace {
+        using simd::detail::bulkKernels;
+
+        void checkSizes(std::size_t a, std::size_t b, std::size_t out) {
+            if (a != b || a != out) {
+                throw std::invalid_argument("Array sizes do not match");
+            }
+        }
+
+        void checkSizes(std::size_t a, std::size_t out) {
+            if (a != out) {
+                throw std::invalid_argument("Array sizes do not match");
+            }
+        }
+
+        void arrayArray(simd::detail::Op op, std::span<const double> a, std::span<const double> b,
+                        std::span<double> out) {
+            checkSizes(a.size(), b.size(), out.size());
+            bulkKernels().arrayArray[op](a.data(), b.data(), out.data(), a.size());
+        }
+
+        void arrayScalar(simd::detail::Op op, std::span<const double> a, double b, std::span<double> out) {
+            checkSizes(a.size(), out.size());
+            bulkKernels().arrayScalar[op](a.data(), b, out.data(), a.size());
+        }
+
+        void maskedArrayArray(simd::detail::Op op, std::span<const double> a, std::span<const double> b,
+                              std::span<double> out, const LaneMask& where) {
+            checkSizes(a.size(), b.size(), out.size());
+            checkSizes(where.size(), out.size());
+            bulkKernels().maskedArrayArray[op](a.data(), b.data(), out.data(), where.words().data(), a.size());
+        }
+
+        void maskedArrayScalar(simd::detail::Op op, std::span<const double> a, double b, std::span<double> out,
+                               const LaneMask& where) {
+            checkSizes(a.size(), out.size());
+            checkSizes(where.size(), out.size());
+            bulkKernels().maskedArrayScalar[op](a.data(), b, out.data(), where.words().data(), a.size());
+        }
+
+        simd::detail::Cmp toKernelCmp(Comparison cmp) {
+            switch (cmp) {
+            case Comparison::Less:
+                return simd::detail::Less;
+            case Comparison::LessEqual:
+                return simd::detail::LessEqual;
+            case Comparison::Greater:
+                return simd::detail::Greater;
+            case Comparison::GreaterEqual:
+                return simd::detail::GreaterEqual;
+            case Comparison::Equal:
+                return simd::detail::Equal;
+            default:
+                return simd::detail::NotEqual;
+            }
+        }
     }
 
-    double subtract(double a, double b) {
-        return a - b;
+    void add(std::span<const double> a, std::span<const double> b, std::span<double> out) {
+        arrayArray(simd::detail::Add, a, b, out);
     }
 
-    double multiply(double a, double b) {
-        return a * b;
+    void add(std::span<const double> a, double b, std::span<double> out) {
+        arrayScalar(simd::detail::Add, a, b, out);
     }
 
-    double divide(double a, double b) {
-        if (std::abs(b) < 1e-10) {
+    void subtract(std::span<const double> a, std::span<const double> b, std::span<double> out) {
+        arrayArray(simd::detail::Subtract, a, b, out);
+    }
+
+    void subtract(std::span<const double> a, double b, std::span<double> out) {
+        arrayScalar(simd::detail::Subtract, a, b, out);
+    }
+
+    void multiply(std::span<const double> a, std::span<const double> b, std::span<double> out) {
+        arrayArray(simd::detail::Multiply, a, b, out);
+    }
+
+    void multiply(std::span<const double> a, double b, std::span<double> out) {
+        arrayScalar(simd::detail::Multiply, a, b, out);
+    }
+
+    void divide(std::span<const double> a, std::span<const double> b, std::span<double> out) {
+        checkSizes(a.size(), b.size(), out.size());
+        if (bulkKernels().anyAbsBelow(b.data(), b.size(), kZeroThreshold)) {
             throw std::invalid_argument("Division by zero is not allowed");
         }
-        return a / b;
+        arrayArray(simd::detail::Divide, a, b, out);
     }
-}
 
-// Calculator class implementation
+    void divide(std::span<const double> a, double b, std::span<double> out) {
+        checkSizes(a.size(), out.size());
+        if (std::abs(b) < kZeroThreshold) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        arrayScalar(simd::detail::Divide, a, b, out);
+    }
 
-Calculator::Calculator() : value_(0.0) {
-}
+    void divide(std::span<const double> a, const Divisor<double>& b, std::span<double> out) {
+        checkSizes(a.size(), out.size());
+        if (!b.hasExactReciprocal()) {
+            bulkKernels().arrayScalar[simd::detail::Divide](a.data(), b.value(), out.data(), a.size());
+            return;
+        }
+        bulkKernels().reciprocalDivide(a.data(), b.value(), b.reciprocal(), out.data(), a.size());
+    }
 
-Calculator::Calculator(double initial_value) : value_(initial_value) {
-}
+    void compare(std::span<const double> a, Comparison cmp, double b, LaneMask& out) {
+        out.assign(a.size(), false);
+        bulkKernels().compareScalar[toKernelCmp(cmp)](a.data(), b, out.words().data(), a.size());
+    }
 
-Calculator::Calculator(const Calculator& other) : value_(other.value_) {
-}
+    void add(std::span<const double> a, std::span<const double> b, std::span<double> out, const LaneMask& where) {
+        maskedArrayArray(simd::detail::Add, a, b, out, where);
+    }
 
-Calculator& Calculator::operator=(const Calculator& other) {
-    if (this != &other) {
-        value_ = other.value_;
+    void add(std::span<const double> a, double b, std::span<double> out, const LaneMask& where) {
+        maskedArrayScalar(simd::detail::Add, a, b, out, where);
     }
-    return *this;
-}
 
-double Calculator::getValue() const {
-    return value_;
-}
+    void subtract(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                  const LaneMask& where) {
+        maskedArrayArray(simd::detail::Subtract, a, b, out, where);
+    }
 
-Calculator& Calculator::setValue(double value) {
-    value_ = value;
-    return *this;
-}
+    void subtract(std::span<const double> a, double b, std::span<double> out, const LaneMask& where) {
+        maskedArrayScalar(simd::detail::Subtract, a, b, out, where);
+    }
 
-Calculator& Calculator::add(double value) {
-    value_ = MathUtils::add(value_, value);
-    return *this;
-}
+    void multiply(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                  const LaneMask& where) {
+        maskedArrayArray(simd::detail::Multiply, a, b, out, where);
+    }
 
-Calculator& Calculator::subtract(double value) {
-    value_ = MathUtils::subtract(value_, value);
-    return *this;
-}
+    void multiply(std::span<const double> a, double b, std::span<double> out, const LaneMask& where) {
+        maskedArrayScalar(simd::detail::Multiply, a, b, out, where);
+    }
 
-Calculator& Calculator::multiply(double value) {
-    value_ = MathUtils::multiply(value_, value);
-    return *this;
-}
+    void divide(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                const LaneMask& where) {
+        checkSizes(a.size(), b.size(), out.size());
+        checkSizes(where.size(), out.size());
+        if (bulkKernels().maskedAnyAbsBelow(b.data(), where.words().data(), b.size(), kZeroThreshold)) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        maskedArrayArray(simd::detail::Divide, a, b, out, where);
+    }
 
-Calculator& Calculator::divide(double value) {
-    value_ = MathUtils::divide(value_, value);
-    return *this;
-}
+    void divide(std::span<const double> a, double b, std::span<double> out, const LaneMask& where) {
+        checkSizes(a.size(), out.size());
+        checkSizes(where.size(), out.size());
+        if (isNearZero(b) && where.any()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        maskedArrayScalar(simd::detail::Divide, a, b, out, where);
+    }
 
-Calculator& Calculator::reset() {
-    value_ = 0.0;
-    return *this;
-}
+    namespace detail {
+        void divideLanes(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                         LaneMask& errors) {
+            checkSizes(a.size(), b.size(), out.size());
+            errors.assign(out.size(), false);
+            bulkKernels().checkedDivide(a.data(), b.data(), out.data(), errors.words().data(), a.size(),
+                                        kZeroThreshold);
+        }
 
-std::string Calculator::toString(int precision) const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(precision) << value_;
-    return oss.str();
+        void divideLanes(std::span<const double> a, double b, std::span<double> out, LaneMask& errors) {
+            checkSizes(a.size(), out.size());
+            bool failed = isNearZero(b);
+            errors.assign(out.size(), failed);
+            if (!failed) {
+                arrayScalar(simd::detail::Divide, a, b, out);
+            } else if (out.data() != a.data()) {
+                std::copy(a.begin(), a.end(), out.begin());
+            }
+        }
+    }
 }
 
-bool Calculator::operator==(const Calculator& other) const {
-    const double epsilon = 1e-9;
-    return std::abs(value_ - other.value_) < epsilon;
-}
+template class BasicCalculator<double, MathUtils::ThrowingDivision>;
+template class BasicCalculator<double, MathUtils::IeeeDivision>;
+template class BasicCalculator<double, MathUtils::SaturatingDivision>;
+template class BasicCalculator<double, MathUtils::LatchingDivision>;
 
-bool Calculator::operator!=(const Calculator& other) const {
-    return !(*this == other);
-}
+template class BasicCalculator<float, MathUtils::ThrowingDivision>;
+template class BasicCalculator<float, MathUtils::IeeeDivision>;
+template class BasicCalculator<float, MathUtils::SaturatingDivision>;
+template class BasicCalculator<float, MathUtils::LatchingDivision>;
+
+template class BasicCalculator<long double, MathUtils::ThrowingDivision>;
+template class BasicCalculator<long double, MathUtils::IeeeDivision>;
+template class BasicCalculator<long double, MathUtils::SaturatingDivision>;
+template class BasicCalculator<long double, MathUtils::LatchingDivision>;
+
+// Integer division by zero is undefined, so integers get no IeeeDivision
+template class BasicCalculator<std::int32_t, MathUtils::ThrowingDivision>;
+template class BasicCalculator<std::int32_t, MathUtils::SaturatingDivision>;
+template class BasicCalculator<std::int32_t, MathUtils::LatchingDivision>;
+
+template class BasicCalculator<std::int64_t, MathUtils::ThrowingDivision>;
+template class BasicCalculator<std::int64_t, MathUtils::SaturatingDivision>;
+template class BasicCalculator<std::int64_t, MathUtils::LatchingDivision>;
 
 /**
  * @example calculator_example.cpp
@@ -135,4 +256,4 @@ bool Calculator::operator!=(const Calculator& other) const {
  *     return 0;
  * }
  * ```
- */
\ No newline at end of file
+ */
@@ -19,8 +19,30 @@
 #ifndef CALCULATOR_H
 #define CALCULATOR_H
 
+/**
+ * @def CALCULATOR_INLINE
+ * @brief Linkage of the non-constexpr Calculator members
+ *
+ * Expands to `inline` when `CALCULATOR_HEADER_ONLY` is defined, and to
+ * nothing otherwise. See calculator_inline.h.
+ */
+#ifdef CALCULATOR_HEADER_ONLY
+#define CALCULATOR_INLINE inline
+#else
+#define CALCULATOR_INLINE
+#endif
+
+#include "division_policy.h"
+#include "divisor.h"
+#include "lane_mask.h"
+#include "numeric_traits.h"
+#include <charconv>
+#include <concepts>
+#include <expected>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 /**
  * @namespace MathUtils
@@ -28,10 +50,66 @@
  * 
  * This namespace contains standalone utility functions that can be used
  * independently of the Calculator class for basic arithmetic operations.
+ *
+ * The scalar functions work in double unless a value type is named
+ * explicitly, as in `MathUtils::add<float>(a, b)`; arguments always convert
+ * to that type, exactly as they convert to double in an untyped call.
  */
 namespace MathUtils {
+    /**
+     * @brief Failure reported by the non-throwing operations
+     */
+    enum class MathError {
+        DivisionByZero, ///< Divisor is zero for its type, see NumericTraits::isNearZero
+        Overflow        ///< A checked integer result did not fit, see CheckedInt64
+    };
+
+    /**
+     * @brief Element test used to build a LaneMask, see compare()
+     *
+     * Comparisons are exact IEEE 754 comparisons: a NaN element only
+     * satisfies NotEqual.
+     */
+    enum class Comparison {
+        Less,         ///< a[i] < b
+        LessEqual,    ///< a[i] <= b
+        Greater,      ///< a[i] > b
+        GreaterEqual, ///< a[i] >= b
+        Equal,        ///< a[i] == b
+        NotEqual      ///< a[i] != b
+    };
+
+    /// @cond INTERNAL
+    namespace detail {
+        /// Division-by-zero flag of a LatchingDivision calculator; takes no space otherwise
+        template <bool Latching>
+        struct ZeroDivisorFlag {
+            constexpr bool get() const {
+                return false;
+            }
+
+            constexpr void set(bool) {
+            }
+        };
+
+        template <>
+        struct ZeroDivisorFlag<true> {
+            bool value = false;
+
+            constexpr bool get() const {
+                return value;
+            }
+
+            constexpr void set(bool latched) {
+                value = latched;
+            }
+        };
+    }
+    /// @endcond
+
     /**
      * @brief Adds two numbers together
+     * @tparam T Value type (default: double)
      * @param a First operand
      * @param b Second operand
      * @return Sum of a and b
@@ -41,10 +119,14 @@ namespace MathUtils {
      * double result = MathUtils::add(3.5, 2.1); // result = 5.6
      * ```
      */
-    double add(double a, double b);
+    template <typename T = double>
+    constexpr T add(std::type_identity_t<T> a, std::type_identity_t<T> b) {
+        return a + b;
+    }
 
     /**
      * @brief Subtracts second number from first number
+     * @tparam T Value type (default: double)
      * @param a Minuend (number to subtract from)
      * @param b Subtrahend (number to subtract)
      * @return Difference of a and b
@@ -54,10 +136,14 @@ namespace MathUtils {
      * double result = MathUtils::subtract(10.0, 3.0); // result = 7.0
      * ```
      */
-    double subtract(double a, double b);
+    template <typename T = double>
+    constexpr T subtract(std::type_identity_t<T> a, std::type_identity_t<T> b) {
+        return a - b;
+    }
 
     /**
      * @brief Multiplies two numbers
+     * @tparam T Value type (default: double)
      * @param a First factor
      * @param b Second factor
      * @return Product of a and b
@@ -67,7 +153,10 @@ namespace MathUtils {
      * double result = MathUtils::multiply(4.0, 2.5); // result = 10.0
      * ```
      */
-    double multiply(double a, double b);
+    template <typename T = double>
+    constexpr T multiply(std::type_identity_t<T> a, std::type_identity_t<T> b) {
+        return a * b;
+    }
 
     /**
      * @brief Divides first number by second number
@@ -82,13 +171,308 @@ namespace MathUtils {
      * ```
      * 
      * @warning Division by zero will throw an exception
+     *
+     * Other value types divide through the policy form,
+     * `MathUtils::divide<MathUtils::ThrowingDivision>(a, b)`.
      */
-    double divide(double a, double b);
+    constexpr double divide(double a, double b) {
+        return ThrowingDivision::divide(a, b);
+    }
+
+    /**
+     * @brief Divides first number by second number without throwing
+     * @tparam T Value type (default: double)
+     * @param a Dividend (number to be divided)
+     * @param b Divisor (number to divide by)
+     * @return Quotient of a divided by b, or MathError::DivisionByZero
+     *
+     * Uses the same zero threshold as divide(), but reports failure in the
+     * return value, so hot paths with frequent near-zero divisors do not pay
+     * for exception unwinding.
+     *
+     * @example
+     * ```cpp
+     * auto q = MathUtils::tryDivide(15.0, 0.0);
+     * if (!q) {
+     *     // q.error() == MathUtils::MathError::DivisionByZero
+     * }
+     * ```
+     */
+    template <typename T = double>
+    constexpr std::expected<T, MathError> tryDivide(std::type_identity_t<T> a, std::type_identity_t<T> b)
+        noexcept(std::is_arithmetic_v<T>) {
+        if (NumericTraits<T>::isNearZero(b)) {
+            return std::unexpected(MathError::DivisionByZero);
+        }
+        return a / b;
+    }
+
+    /**
+     * @name Bulk operations
+     * @brief Element-wise kernels over contiguous arrays
+     *
+     * These overloads are the fast path for bulk work: they process a whole
+     * column per call in a tight loop the compiler can vectorize, instead of
+     * paying one out-of-line call per element. Every element follows the
+     * same semantics as the scalar function of the same name. The vector
+     * width is chosen at runtime for the host CPU (see simd_dispatch.h).
+     *
+     * @p out may alias @p a (in-place update) but must not partially overlap
+     * any input.
+     *
+     * @example
+     * ```cpp
+     * std::vector<double> prices = {10.0, 20.0, 30.0};
+     * std::vector<double> taxed(prices.size());
+     * MathUtils::multiply(prices, 1.2, taxed); // taxed = {12.0, 24.0, 36.0}
+     * ```
+     * @{
+     */
+
+    /**
+     * @brief Adds two arrays element-wise
+     * @param a First operand array
+     * @param b Second operand array
+     * @param out Destination array receiving a[i] + b[i]
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void add(std::span<const double> a, std::span<const double> b, std::span<double> out);
+
+    /**
+     * @brief Adds a scalar to every element of an array
+     * @param a Operand array
+     * @param b Scalar added to each element
+     * @param out Destination array receiving a[i] + b
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void add(std::span<const double> a, double b, std::span<double> out);
+
+    /**
+     * @brief Subtracts two arrays element-wise
+     * @param a Minuend array
+     * @param b Subtrahend array
+     * @param out Destination array receiving a[i] - b[i]
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void subtract(std::span<const double> a, std::span<const double> b, std::span<double> out);
+
+    /**
+     * @brief Subtracts a scalar from every element of an array
+     * @param a Minuend array
+     * @param b Scalar subtracted from each element
+     * @param out Destination array receiving a[i] - b
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void subtract(std::span<const double> a, double b, std::span<double> out);
+
+    /**
+     * @brief Multiplies two arrays element-wise
+     * @param a First factor array
+     * @param b Second factor array
+     * @param out Destination array receiving a[i] * b[i]
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void multiply(std::span<const double> a, std::span<const double> b, std::span<double> out);
+
+    /**
+     * @brief Multiplies every element of an array by a scalar
+     * @param a Factor array
+     * @param b Scalar factor
+     * @param out Destination array receiving a[i] * b
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    void multiply(std::span<const double> a, double b, std::span<double> out);
+
+    /**
+     * @brief Divides two arrays element-wise
+     * @param a Dividend array
+     * @param b Divisor array
+     * @param out Destination array receiving a[i] / b[i]
+     * @throws std::invalid_argument if the array sizes differ or any divisor is zero
+     *
+     * All divisors are validated before anything is written, so @p out is
+     * left untouched when an exception is thrown.
+     */
+    void divide(std::span<const double> a, std::span<const double> b, std::span<double> out);
+
+    /**
+     * @brief Divides every element of an array by a scalar
+     * @param a Dividend array
+     * @param b Scalar divisor
+     * @param out Destination array receiving a[i] / b
+     * @throws std::invalid_argument if the array sizes differ or the divisor is zero
+     */
+    void divide(std::span<const double> a, double b, std::span<double> out);
+
+    /**
+     * @brief Divides every element of an array by a prepared divisor
+     * @param a Dividend array
+     * @param b Divisor, validated when it was built
+     * @param out Destination array receiving a[i] / b.value()
+     * @throws std::invalid_argument if the array sizes differ
+     *
+     * Bit-identical to dividing by b.value(). With AVX2 or AVX-512 each
+     * vector is multiplied by the reciprocal and corrected with two FMAs,
+     * which issue several times faster than a vector divide; a vector with
+     * an operand outside the exact range (zero, subnormal, infinite, NaN)
+     * is divided instead. SSE2 and scalar builds have no FMA and divide.
+     */
+    void divide(std::span<const double> a, const Divisor<double>& b, std::span<double> out);
+
+    /// @cond INTERNAL
+    namespace detail {
+        void divideLanes(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                         LaneMask& errors);
+        void divideLanes(std::span<const double> a, double b, std::span<double> out, LaneMask& errors);
+    }
+    /// @endcond
+
+    /**
+     * @brief Divides two arrays element-wise, flagging zero divisors per lane
+     * @tparam DivPolicy Decides the value left in a failed lane
+     * @param a Dividend array
+     * @param b Divisor array
+     * @param out Destination array receiving a[i] / b[i]
+     * @param errors Resized to out.size(); bit i is set where |b[i]| is
+     *        below the 1e-10 zero threshold
+     * @throws std::invalid_argument if the array sizes differ
+     *
+     * Never throws on a zero divisor, so one bad lane cannot abort a whole
+     * column. A failed lane receives DivPolicy::divide(a[i], b[i]), except
+     * under ThrowingDivision, where it keeps the dividend a[i] as
+     * LatchingDivision does. The failures are fixed up after the
+     * vector pass, touching only the flagged lanes.
+     *
+     * @example
+     * ```cpp
+     * MathUtils::LaneMask errors;
+     * MathUtils::tryDivide<MathUtils::SaturatingDivision>(a, b, out, errors);
+     * if (errors.any()) {
+     *     // out[i] == ±DBL_MAX wherever errors.test(i)
+     * }
+     * ```
+     */
+    template <typename DivPolicy = ThrowingDivision>
+    void tryDivide(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                   LaneMask& errors) {
+        detail::divideLanes(a, b, out, errors);
+        if constexpr (!std::is_same_v<DivPolicy, ThrowingDivision>) {
+            // Failed lanes still hold their dividend, even when out aliases a
+            errors.forEachSet([&](std::size_t i) { out[i] = DivPolicy::divide(out[i], b[i]); });
+        }
+    }
+
+    /**
+     * @brief Divides every element of an array by a scalar, flagging failures
+     * @tparam DivPolicy Decides the value left in a failed lane
+     * @param a Dividend array
+     * @param b Scalar divisor
+     * @param out Destination array receiving a[i] / b
+     * @param errors Resized to out.size(); every bit is set if |b| is below
+     *        the zero threshold, none otherwise
+     * @throws std::invalid_argument if the array sizes differ
+     */
+    template <typename DivPolicy = ThrowingDivision>
+    void tryDivide(std::span<const double> a, double b, std::span<double> out, LaneMask& errors) {
+        detail::divideLanes(a, b, out, errors);
+        if constexpr (!std::is_same_v<DivPolicy, ThrowingDivision>) {
+            errors.forEachSet([&](std::size_t i) { out[i] = DivPolicy::divide(out[i], b); });
+        }
+    }
+
+    /** @} */
+
+    /**
+     * @brief Compares every element of an array with a scalar
+     * @param a Array to test
+     * @param cmp Comparison to apply
+     * @param b Scalar right-hand side
+     * @param out Resized to a.size(); bit i is set where `a[i] cmp b` holds
+     *
+     * @example
+     * ```cpp
+     * MathUtils::LaneMask rich;
+     * MathUtils::compare(balances, MathUtils::Comparison::Greater, 10'000.0, rich);
+     * MathUtils::subtract(balances, 25.0, balances, rich); // fee only where rich
+     * ```
+     */
+    void compare(std::span<const double> a, Comparison cmp, double b, LaneMask& out);
+
+    /**
+     * @name Masked bulk operations
+     * @brief Element-wise kernels applied only where a mask bit is set
+     *
+     * out[i] receives the result of the operation where bit i of @p where
+     * is set, and a[i] unchanged elsewhere. Selection uses vector blends or
+     * AVX-512 write masks, not per-element branches. The aliasing rules and
+     * the semantics of the selected lanes are those of the unmasked
+     * overloads; in particular divide() only checks the divisors of
+     * selected lanes against the 1e-10 threshold. To divide wherever the
+     * divisor is valid and skip the rest, use tryDivide() instead.
+     *
+     * Every overload throws std::invalid_argument if the array or mask
+     * sizes differ.
+     * @{
+     */
+
+    /**
+     * @brief Adds two arrays element-wise where the mask is set
+     */
+    void add(std::span<const double> a, std::span<const double> b, std::span<double> out, const LaneMask& where);
+
+    /**
+     * @brief Adds a scalar to the selected elements of an array
+     */
+    void add(std::span<const double> a, double b, std::span<double> out, const LaneMask& where);
+
+    /**
+     * @brief Subtracts two arrays element-wise where the mask is set
+     */
+    void subtract(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                  const LaneMask& where);
+
+    /**
+     * @brief Subtracts a scalar from the selected elements of an array
+     */
+    void subtract(std::span<const double> a, double b, std::span<double> out, const LaneMask& where);
+
+    /**
+     * @brief Multiplies two arrays element-wise where the mask is set
+     */
+    void multiply(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                  const LaneMask& where);
+
+    /**
+     * @brief Multiplies the selected elements of an array by a scalar
+     */
+    void multiply(std::span<const double> a, double b, std::span<double> out, const LaneMask& where);
+
+    /**
+     * @brief Divides two arrays element-wise where the mask is set
+     * @throws std::invalid_argument if a selected divisor is zero; @p out
+     *         is then left untouched
+     */
+    void divide(std::span<const double> a, std::span<const double> b, std::span<double> out,
+                const LaneMask& where);
+
+    /**
+     * @brief Divides the selected elements of an array by a scalar
+     * @throws std::invalid_argument if the divisor is zero and any lane is
+     *         selected
+     */
+    void divide(std::span<const double> a, double b, std::span<double> out, const LaneMask& where);
+
+    /** @} */
 }
 
 /**
- * @class Calculator
+ * @class BasicCalculator
  * @brief A chainable calculator class for performing arithmetic operations
+ * @tparam T Value type: float, double, long double, an integer type, or a
+ *         custom type with arithmetic operators and a NumericTraits
+ *         specialization
+ * @tparam DivPolicy What divide() does with a near-zero divisor, see
+ *         division_policy.h
  * 
  * The Calculator class maintains an internal state and allows chaining
  * of arithmetic operations. It provides a fluent interface for complex
@@ -110,23 +494,74 @@ namespace MathUtils {
  *     std::cout << "Error: " << e.what() << std::endl;
  * }
  * ```
+ *
+ * @example Compile-time evaluation:
+ * ```cpp
+ * constexpr double kPrice = Calculator(100.0).multiply(1.2).add(5.0).getValue(); // 125.0
+ * constexpr double kBad = Calculator(1.0).divide(0.0).getValue(); // compile error
+ * ```
+ *
+ * Constructors, getValue() and the arithmetic members are constexpr, so a
+ * chain of constants folds to a literal. In a constant expression a
+ * division by zero is a compile error instead of a runtime throw. At run
+ * time they inline like the built-in operators, so a compiler allowed to
+ * contract floating-point expressions (GCC's default once FMA
+ * instructions are enabled, e.g. by -march=native) may fuse multiply()
+ * followed by add() into one FMA. Calculator then matches a recorded
+ * Program bit for bit only in builds with -ffp-contract=off, which
+ * tests/run_tests.sh and bench/run_benchmarks.sh always pass.
+ *
+ * @example Other value types:
+ * ```cpp
+ * BasicCalculator<float> f(1.5f);
+ * BasicCalculator<std::int64_t> i(7);
+ * i.divide(2); // value = 3, integer division
+ * i.divide(0); // throws: for integers only an exact 0 is a zero divisor
+ * ```
+ *
+ * What counts as a zero divisor, the tolerance of operator== and the
+ * formatting of toString() come from MathUtils::NumericTraits<T>.
+ * calculator.cpp explicitly instantiates float, double, long double,
+ * std::int32_t and std::int64_t. The calculators on the other value types
+ * of this library have their own header, which is not included here:
+ * compensated_calculator.h, double_double_calculator.h,
+ * big_int_calculator.h, rational_calculator.h, decimal_calculator.h and
+ * integer_calculator.h, each instantiating its types in the matching .cpp
+ * file. For any other type, either define `CALCULATOR_HEADER_ONLY` or
+ * include calculator_inline.h in one source file and instantiate the class
+ * there. To capture a chain into a Program, use RecordingCalculator
+ * (recording_calculator.h).
  */
-class Calculator {
+template <typename T, typename DivPolicy = MathUtils::ThrowingDivision>
+class BasicCalculator {
 private:
-    double value_; ///< Current value stored in the calculator
+    T value_; ///< Current value stored in the calculator
+    /// Set by a near-zero divisor under LatchingDivision, see hasError()
+    [[no_unique_address]] MathUtils::detail::ZeroDivisorFlag<std::is_same_v<DivPolicy, MathUtils::LatchingDivision>>
+        divisionByZero_;
+
+    // Checked integers carry their overflow flag in the value itself
+    constexpr bool overflowed() const {
+        if constexpr (requires { value_.overflowed(); }) {
+            return value_.overflowed();
+        } else {
+            return false;
+        }
+    }
 
 public:
     /**
      * @brief Default constructor initializing calculator to zero
      * 
-     * Creates a new Calculator instance with an initial value of 0.0.
+     * Creates a new Calculator instance with an initial value of zero.
      * 
      * @example
      * ```cpp
      * Calculator calc; // value = 0.0
      * ```
      */
-    Calculator();
+    constexpr BasicCalculator() : value_(T(0)) {
+    }
 
     /**
      * @brief Constructor with initial value
@@ -139,7 +574,8 @@ public:
      * Calculator calc(42.5); // value = 42.5
      * ```
      */
-    explicit Calculator(double initial_value);
+    constexpr explicit BasicCalculator(T initial_value) : value_(initial_value) {
+    }
 
     /**
      * @brief Copy constructor
@@ -147,7 +583,16 @@ public:
      * 
      * Creates a new Calculator instance as a copy of another calculator.
      */
-    Calculator(const Calculator& other);
+    constexpr BasicCalculator(const BasicCalculator& other) = default;
+
+    /**
+     * @brief Move constructor
+     * @param other Calculator instance to move from
+     *
+     * noexcept whenever moving T is, so containers of calculators move
+     * rather than copy when they grow.
+     */
+    constexpr BasicCalculator(BasicCalculator&& other) = default;
 
     /**
      * @brief Assignment operator
@@ -156,14 +601,21 @@ public:
      * 
      * Assigns the value from another calculator to this instance.
      */
-    Calculator& operator=(const Calculator& other);
+    constexpr BasicCalculator& operator=(const BasicCalculator& other) = default;
+
+    /**
+     * @brief Move assignment operator
+     * @param other Calculator instance to move from
+     * @return Reference to this calculator
+     */
+    constexpr BasicCalculator& operator=(BasicCalculator&& other) = default;
 
     /**
      * @brief Destructor
      * 
      * Cleans up calculator resources (default destructor).
      */
-    ~Calculator() = default;
+    constexpr ~BasicCalculator() = default;
 
     /**
      * @brief Gets the current value
@@ -175,7 +627,9 @@ public:
      * double current = calc.getValue(); // current = 15.5
      * ```
      */
-    double getValue() const;
+    constexpr T getValue() const {
+        return value_;
+    }
 
     /**
      * @brief Sets the calculator value
@@ -188,7 +642,10 @@ public:
      * calc.setValue(100.0).add(50.0); // Sets to 100, then adds 50
      * ```
      */
-    Calculator& setValue(double value);
+    constexpr BasicCalculator& setValue(T value) {
+        value_ = value;
+        return *this;
+    }
 
     /**
      * @brief Adds a value to the current result
@@ -201,7 +658,10 @@ public:
      * calc.add(5.5); // Result: 15.5
      * ```
      */
-    Calculator& add(double value);
+    constexpr BasicCalculator& add(T value) {
+        value_ = MathUtils::add<T>(value_, value);
+        return *this;
+    }
 
     /**
      * @brief Subtracts a value from the current result
@@ -214,7 +674,10 @@ public:
      * calc.subtract(7.3); // Result: 12.7
      * ```
      */
-    Calculator& subtract(double value);
+    constexpr BasicCalculator& subtract(T value) {
+        value_ = MathUtils::subtract<T>(value_, value);
+        return *this;
+    }
 
     /**
      * @brief Multiplies the current result by a value
@@ -227,13 +690,20 @@ public:
      * calc.multiply(1.5); // Result: 9.0
      * ```
      */
-    Calculator& multiply(double value);
+    constexpr BasicCalculator& multiply(T value) {
+        value_ = MathUtils::multiply<T>(value_, value);
+        return *this;
+    }
 
     /**
      * @brief Divides the current result by a value
      * @param value Value to divide by
      * @return Reference to this calculator for chaining
-     * @throws std::invalid_argument if value is zero
+     * @throws std::invalid_argument if value is zero (ThrowingDivision only)
+     *
+     * A near-zero divisor is handled by DivPolicy; with the default policy
+     * it throws. Under LatchingDivision the current value is left unchanged
+     * and MathError::DivisionByZero is latched instead, see hasError().
      * 
      * @example
      * ```cpp
@@ -243,7 +713,93 @@ public:
      * 
      * @warning Division by zero throws an exception
      */
-    Calculator& divide(double value);
+    constexpr BasicCalculator& divide(T value) {
+        if constexpr (std::is_same_v<DivPolicy, MathUtils::LatchingDivision>) {
+            if (MathUtils::NumericTraits<T>::isNearZero(value)) {
+                divisionByZero_.set(true);
+            }
+        }
+        value_ = MathUtils::divide<DivPolicy>(value_, value);
+        return *this;
+    }
+
+    /**
+     * @brief Divides the current result by a prepared divisor
+     * @param divisor Divisor, validated when it was built
+     * @return Reference to this calculator for chaining
+     *
+     * Gives the same result as divide(divisor.value()) without checking
+     * the divisor again, and for float, double and integers without a
+     * hardware divide (see divisor.h). Meant for loops that divide many
+     * calculators by one value.
+     *
+     * @example
+     * ```cpp
+     * const MathUtils::Divisor<double> rate(1.19);
+     * for (Calculator& calc : ledger) {
+     *     calc.divide(rate);
+     * }
+     * ```
+     */
+    constexpr BasicCalculator& divide(const MathUtils::Divisor<T>& divisor) {
+        if constexpr (std::is_integral_v<T>) {
+            if (divisor.value() == T(-1)) {
+                return divide(divisor.value()); // min / -1 as DivPolicy says
+            }
+        }
+        value_ = divisor.divide(value_);
+        return *this;
+    }
+
+    /**
+     * @brief Checks whether a non-throwing operation has failed
+     * @return True if a division by zero is latched (LatchingDivision
+     *         only), or if a checked integer value has overflowed
+     *
+     * The latch is sticky: a whole chain can run without branches on the
+     * caller's side and be checked once at the end.
+     *
+     * @example
+     * ```cpp
+     * LatchingCalculator calc(15);
+     * calc.divide(0.0).add(1.0); // value = 16, nothing thrown
+     * if (!calc.result()) {
+     *     // calc.result().error() == MathUtils::MathError::DivisionByZero
+     * }
+     * ```
+     */
+    constexpr bool hasError() const {
+        return divisionByZero_.get() || overflowed();
+    }
+
+    /**
+     * @brief Gets the current value, or the latched error
+     * @return Current value if no error is latched; otherwise
+     *         MathError::DivisionByZero once a division has been latched,
+     *         else MathError::Overflow once a checked integer value has
+     *         overflowed
+     */
+    constexpr std::expected<T, MathUtils::MathError> result() const {
+        if (divisionByZero_.get()) {
+            return std::unexpected(MathUtils::MathError::DivisionByZero);
+        }
+        if (overflowed()) {
+            return std::unexpected(MathUtils::MathError::Overflow);
+        }
+        return value_;
+    }
+
+    /**
+     * @brief Clears the latched error and the overflow flag of the value
+     * @return Reference to this calculator for chaining
+     */
+    constexpr BasicCalculator& clearError() {
+        divisionByZero_.set(false);
+        if constexpr (requires { value_.overflowed(); }) {
+            value_ = T(value_.value());
+        }
+        return *this;
+    }
 
     /**
      * @brief Resets the calculator to zero
@@ -255,12 +811,41 @@ public:
      * calc.reset(); // Result: 0.0
      * ```
      */
-    Calculator& reset();
+    constexpr BasicCalculator& reset() {
+        value_ = T(0);
+        return *this;
+    }
+
+    /**
+     * @brief Writes the current value as fixed-point text into a caller buffer
+     * @param first Start of the destination buffer
+     * @param last One past the end of the destination buffer
+     * @param precision Number of decimal places (default: 2)
+     * @return std::to_chars_result: `ptr` is one past the last character
+     *         written, `ec` is std::errc::value_too_large if the buffer is
+     *         too small (its contents are then unspecified)
+     *
+     * Produces the same text as toString() without allocating and without
+     * touching locales. No terminating null is written. The text comes
+     * from NumericTraits<T>::toChars().
+     *
+     * @example
+     * ```cpp
+     * Calculator calc(3.14159);
+     * char buffer[32];
+     * auto [end, ec] = calc.toChars(buffer, buffer + sizeof(buffer), 3);
+     * std::string_view text(buffer, end - buffer); // "3.142"
+     * ```
+     */
+    std::to_chars_result toChars(char* first, char* last, int precision = 2) const;
 
     /**
      * @brief Converts calculator value to string
      * @param precision Number of decimal places (default: 2)
      * @return String representation of the current value
+     *
+     * Implemented on top of toChars(); short results fit the string's
+     * inline storage and do not allocate.
      * 
      * @example
      * ```cpp
@@ -275,16 +860,48 @@ public:
      * @param other Calculator to compare with
      * @return True if values are equal (within epsilon tolerance)
      * 
-     * Uses a small epsilon value for floating-point comparison.
+     * Uses NumericTraits<T>::approximatelyEqual(): an absolute epsilon for
+     * floating-point types, exact comparison otherwise.
      */
-    bool operator==(const Calculator& other) const;
+    constexpr bool operator==(const BasicCalculator& other) const {
+        return MathUtils::NumericTraits<T>::approximatelyEqual(value_, other.value_);
+    }
 
     /**
      * @brief Inequality comparison operator
      * @param other Calculator to compare with
      * @return True if values are not equal
      */
-    bool operator!=(const Calculator& other) const;
+    constexpr bool operator!=(const BasicCalculator& other) const {
+        return !(*this == other);
+    }
 };
 
+/**
+ * @brief The default calculator: double values, throwing on division by zero
+ */
+using Calculator = BasicCalculator<double, MathUtils::ThrowingDivision>;
+
+/**
+ * @brief Calculator whose divide() follows IEEE 754 (±inf/NaN, no zero check)
+ */
+using IeeeCalculator = BasicCalculator<double, MathUtils::IeeeDivision>;
+
+/**
+ * @brief Calculator whose divide() saturates to ±DBL_MAX on a near-zero divisor
+ */
+using SaturatingCalculator = BasicCalculator<double, MathUtils::SaturatingDivision>;
+
+/**
+ * @brief Calculator whose divide() latches a near-zero divisor instead of throwing
+ *
+ * The failed division leaves the value unchanged; hasError() and result()
+ * report MathUtils::MathError::DivisionByZero until clearError().
+ */
+using LatchingCalculator = BasicCalculator<double, MathUtils::LatchingDivision>;
+
+#ifdef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
 #endif // CALCULATOR_H
\ No newline at end of file
@@ -0,0 +1,142 @@
+/**
+ * @file calculator_batch.cpp
+ * @brief Implementation of CalculatorBatch on top of the bulk kernels
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "calculator_batch.h"
+#include <algorithm>
+#include <stdexcept>
+
+CalculatorBatch::CalculatorBatch(std::size_t size, double initial_value)
+    : values_(size, initial_value) {
+}
+
+CalculatorBatch::CalculatorBatch(std::span<const double> values)
+    : values_(values.begin(), values.end()) {
+}
+
+CalculatorBatch::CalculatorBatch(std::span<const Calculator> calculators)
+    : values_(calculators.size()) {
+    std::transform(calculators.begin(), calculators.end(), values_.begin(),
+                   [](const Calculator& calc) { return calc.getValue(); });
+}
+
+CalculatorBatch& CalculatorBatch::setValue(double value) {
+    std::fill(values_.begin(), values_.end(), value);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::setValue(std::span<const double> values) {
+    if (values.size() != values_.size()) {
+        throw std::invalid_argument("Array sizes do not match");
+    }
+    std::copy(values.begin(), values.end(), values_.begin());
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::add(double value) {
+    MathUtils::add(values_, value, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::add(std::span<const double> values) {
+    MathUtils::add(values_, values, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::subtract(double value) {
+    MathUtils::subtract(values_, value, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::subtract(std::span<const double> values) {
+    MathUtils::subtract(values_, values, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::multiply(double value) {
+    MathUtils::multiply(values_, value, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::multiply(std::span<const double> values) {
+    MathUtils::multiply(values_, values, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::divide(double value) {
+    MathUtils::divide(values_, value, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::divide(const MathUtils::Divisor<double>& divisor) {
+    MathUtils::divide(values_, divisor, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::divide(std::span<const double> values) {
+    MathUtils::divide(values_, values, values_);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::add(double value, const MathUtils::LaneMask& where) {
+    MathUtils::add(values_, value, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::add(std::span<const double> values, const MathUtils::LaneMask& where) {
+    MathUtils::add(values_, values, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::subtract(double value, const MathUtils::LaneMask& where) {
+    MathUtils::subtract(values_, value, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::subtract(std::span<const double> values, const MathUtils::LaneMask& where) {
+    MathUtils::subtract(values_, values, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::multiply(double value, const MathUtils::LaneMask& where) {
+    MathUtils::multiply(values_, value, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::multiply(std::span<const double> values, const MathUtils::LaneMask& where) {
+    MathUtils::multiply(values_, values, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::divide(double value, const MathUtils::LaneMask& where) {
+    MathUtils::divide(values_, value, values_, where);
+    return *this;
+}
+
+CalculatorBatch& CalculatorBatch::divide(std::span<const double> values, const MathUtils::LaneMask& where) {
+    MathUtils::divide(values_, values, values_, where);
+    return *this;
+}
+
+MathUtils::LaneMask CalculatorBatch::compare(MathUtils::Comparison cmp, double value) const {
+    MathUtils::LaneMask mask;
+    MathUtils::compare(values_, cmp, value, mask);
+    return mask;
+}
+
+CalculatorBatch& CalculatorBatch::reset() {
+    return setValue(0.0);
+}
+
+std::vector<Calculator> CalculatorBatch::toCalculators() const {
+    std::vector<Calculator> calculators;
+    calculators.reserve(values_.size());
+    for (double value : values_) {
+        calculators.emplace_back(value);
+    }
+    return calculators;
+}
@@ -0,0 +1,338 @@
+/**
+ * @file calculator_batch.h
+ * @brief Many independent calculators stored as one contiguous column
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A std::vector<Calculator> is an array of objects that each hold one
+ * value, and its operations run one object at a time through the fluent
+ * API, so the compiler only vectorizes them when it can see through every
+ * call. CalculatorBatch keeps the same values as contiguous doubles in
+ * one SIMD-aligned array and applies each fluent operation to every lane
+ * with a single call into the MathUtils bulk kernels, at the widest
+ * vector level the CPU supports.
+ *
+ * @example
+ * ```cpp
+ * CalculatorBatch batch(1'000'000, 100.0); // a million lanes, all 100.0
+ * batch.multiply(1.05).subtract(fees);     // fees: one value per lane
+ * std::vector<Calculator> calculators = batch.toCalculators();
+ * ```
+ */
+
+#ifndef CALCULATOR_BATCH_H
+#define CALCULATOR_BATCH_H
+
+#include "calculator.h"
+#include <cstddef>
+#include <new>
+#include <span>
+#include <vector>
+
+/// @cond INTERNAL
+namespace MathUtils {
+    namespace detail {
+        /// Allocator returning storage aligned for the widest vector registers.
+        template <typename T, std::size_t Alignment>
+        struct AlignedAllocator {
+            using value_type = T;
+
+            template <typename U>
+            struct rebind {
+                using other = AlignedAllocator<U, Alignment>;
+            };
+
+            AlignedAllocator() = default;
+
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, Alignment>&) {
+            }
+
+            T* allocate(std::size_t n) {
+                return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+            }
+
+            void deallocate(T* p, std::size_t) {
+                ::operator delete(p, std::align_val_t(Alignment));
+            }
+
+            template <typename U>
+            bool operator==(const AlignedAllocator<U, Alignment>&) const {
+                return true;
+            }
+        };
+    }
+}
+/// @endcond
+
+/**
+ * @class CalculatorBatch
+ * @brief A fixed number of independent double accumulators, one per lane
+ *
+ * Offers the fluent API of Calculator. Every operation applies to all
+ * lanes, taking either one scalar operand for every lane or a span with
+ * one operand per lane. Lane i behaves exactly like a Calculator holding
+ * values()[i], including the division-by-zero check. Batches do not
+ * record and have no error latch.
+ *
+ * @example
+ * ```cpp
+ * std::vector<double> rates = {1.01, 1.02, 1.03};
+ * CalculatorBatch batch(3, 10.0);
+ * batch.multiply(rates).add(1.0); // {11.1, 11.2, 11.3}
+ * ```
+ */
+class CalculatorBatch {
+public:
+    /// Alignment in bytes of the value array (one AVX-512 register)
+    static constexpr std::size_t kAlignment = 64;
+
+private:
+    std::vector<double, MathUtils::detail::AlignedAllocator<double, kAlignment>> values_; ///< One value per lane
+
+public:
+    /**
+     * @brief Creates an empty batch
+     */
+    CalculatorBatch() = default;
+
+    /**
+     * @brief Creates a batch with every lane set to the same value
+     * @param size Number of lanes
+     * @param initial_value Starting value of every lane (default: 0.0)
+     */
+    explicit CalculatorBatch(std::size_t size, double initial_value = 0.0);
+
+    /**
+     * @brief Creates a batch from one starting value per lane
+     * @param values Starting values, copied in lane order
+     */
+    explicit CalculatorBatch(std::span<const double> values);
+
+    /**
+     * @brief Creates a batch from the current values of calculators
+     * @param calculators Source calculators; only their values are copied
+     */
+    explicit CalculatorBatch(std::span<const Calculator> calculators);
+
+    /**
+     * @brief Gets the number of lanes
+     * @return Lane count
+     */
+    std::size_t size() const {
+        return values_.size();
+    }
+
+    /**
+     * @brief Checks whether the batch has no lanes
+     * @return True if size() == 0
+     */
+    bool empty() const {
+        return values_.empty();
+    }
+
+    /**
+     * @brief Gets the value of one lane
+     * @param index Lane index, must be below size()
+     * @return Current value of the lane
+     */
+    double operator[](std::size_t index) const {
+        return values_[index];
+    }
+
+    /**
+     * @brief Gets all lane values
+     * @return Read-only view of the aligned value array
+     */
+    std::span<const double> values() const {
+        return values_;
+    }
+
+    /**
+     * @brief Gets all lane values for direct modification
+     * @return Mutable view of the aligned value array
+     */
+    std::span<double> values() {
+        return values_;
+    }
+
+    /**
+     * @brief Sets every lane to the same value
+     * @param value New value
+     * @return Reference to this batch for chaining
+     */
+    CalculatorBatch& setValue(double value);
+
+    /**
+     * @brief Sets each lane to its own value
+     * @param values One value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    CalculatorBatch& setValue(std::span<const double> values);
+
+    /**
+     * @brief Adds a value to every lane
+     * @param value Value to add
+     * @return Reference to this batch for chaining
+     */
+    CalculatorBatch& add(double value);
+
+    /**
+     * @brief Adds one value per lane
+     * @param values Values to add, one per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    CalculatorBatch& add(std::span<const double> values);
+
+    /**
+     * @brief Subtracts a value from every lane
+     * @param value Value to subtract
+     * @return Reference to this batch for chaining
+     */
+    CalculatorBatch& subtract(double value);
+
+    /**
+     * @brief Subtracts one value per lane
+     * @param values Values to subtract, one per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    CalculatorBatch& subtract(std::span<const double> values);
+
+    /**
+     * @brief Multiplies every lane by a value
+     * @param value Value to multiply by
+     * @return Reference to this batch for chaining
+     */
+    CalculatorBatch& multiply(double value);
+
+    /**
+     * @brief Multiplies each lane by its own value
+     * @param values Values to multiply by, one per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    CalculatorBatch& multiply(std::span<const double> values);
+
+    /**
+     * @brief Divides every lane by a value
+     * @param value Value to divide by
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if value is zero
+     */
+    CalculatorBatch& divide(double value);
+
+    /**
+     * @brief Divides every lane by a prepared divisor
+     * @param divisor Divisor, validated when it was built
+     * @return Reference to this batch for chaining
+     *
+     * Bit-identical to divide(divisor.value()), but multiplies by the
+     * reciprocal on AVX2 and AVX-512 (see MathUtils::divide()).
+     */
+    CalculatorBatch& divide(const MathUtils::Divisor<double>& divisor);
+
+    /**
+     * @brief Divides each lane by its own value
+     * @param values Values to divide by, one per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if the sizes differ or any divisor is zero
+     *
+     * All divisors are validated first, so on an exception no lane has
+     * changed.
+     */
+    CalculatorBatch& divide(std::span<const double> values);
+
+    /**
+     * @brief Divides every lane by a value without throwing
+     * @tparam DivPolicy Decides the value left in a failed lane, see
+     *         MathUtils::tryDivide()
+     * @param value Value to divide by
+     * @param errors Receives one bit per lane, set where the division failed
+     * @return Reference to this batch for chaining
+     */
+    template <typename DivPolicy = MathUtils::ThrowingDivision>
+    CalculatorBatch& tryDivide(double value, MathUtils::LaneMask& errors) {
+        MathUtils::tryDivide<DivPolicy>(values_, value, values_, errors);
+        return *this;
+    }
+
+    /**
+     * @brief Divides each lane by its own value without throwing
+     * @tparam DivPolicy Decides the value left in a failed lane, see
+     *         MathUtils::tryDivide()
+     * @param values Values to divide by, one per lane
+     * @param errors Receives one bit per lane, set where the division failed
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     *
+     * With the default policy a failed lane keeps its value, so the
+     * remaining operations of a chain apply to it unchanged; inspect
+     * @p errors once the chain is done.
+     *
+     * @example
+     * ```cpp
+     * MathUtils::LaneMask failed;
+     * batch.tryDivide(shares, failed).multiply(100.0);
+     * failed.forEachSet([&](std::size_t i) { report(i); });
+     * ```
+     */
+    template <typename DivPolicy = MathUtils::ThrowingDivision>
+    CalculatorBatch& tryDivide(std::span<const double> values, MathUtils::LaneMask& errors) {
+        MathUtils::tryDivide<DivPolicy>(values_, values, values_, errors);
+        return *this;
+    }
+
+    /**
+     * @name Masked operations
+     * @brief Operations applied only to the lanes selected by a mask
+     *
+     * Lanes whose bit in @p where is clear keep their value. Each overload
+     * throws std::invalid_argument if @p where or @p values does not have
+     * size() lanes. See MathUtils::add() and friends for the masked kernel
+     * semantics, including the divide check on selected lanes only.
+     *
+     * @example
+     * ```cpp
+     * MathUtils::LaneMask rich = batch.compare(MathUtils::Comparison::Greater, 10'000.0);
+     * batch.subtract(25.0, rich); // fee only on balances above 10k
+     * ```
+     * @{
+     */
+
+    CalculatorBatch& add(double value, const MathUtils::LaneMask& where);
+    CalculatorBatch& add(std::span<const double> values, const MathUtils::LaneMask& where);
+    CalculatorBatch& subtract(double value, const MathUtils::LaneMask& where);
+    CalculatorBatch& subtract(std::span<const double> values, const MathUtils::LaneMask& where);
+    CalculatorBatch& multiply(double value, const MathUtils::LaneMask& where);
+    CalculatorBatch& multiply(std::span<const double> values, const MathUtils::LaneMask& where);
+    CalculatorBatch& divide(double value, const MathUtils::LaneMask& where);
+    CalculatorBatch& divide(std::span<const double> values, const MathUtils::LaneMask& where);
+
+    /** @} */
+
+    /**
+     * @brief Builds a mask of the lanes whose value satisfies a comparison
+     * @param cmp Comparison to apply
+     * @param value Right-hand side of the comparison
+     * @return Mask with bit i set where `values()[i] cmp value` holds
+     */
+    MathUtils::LaneMask compare(MathUtils::Comparison cmp, double value) const;
+
+    /**
+     * @brief Resets every lane to zero
+     * @return Reference to this batch for chaining
+     */
+    CalculatorBatch& reset();
+
+    /**
+     * @brief Copies the lanes out as individual calculators
+     * @return One Calculator per lane, in lane order
+     */
+    std::vector<Calculator> toCalculators() const;
+};
+
+#endif // CALCULATOR_BATCH_H
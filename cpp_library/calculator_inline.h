@@ -0,0 +1,63 @@
+/**
+ * @file calculator_inline.h
+ * @brief Definitions of the non-constexpr BasicCalculator members
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * The scalar MathUtils functions and the arithmetic BasicCalculator members
+ * are constexpr and defined in calculator.h, so a chain such as
+ * calc.add(x).multiply(y) inlines into the caller in every build, with or
+ * without LTO (bench/header_only_bench.cpp measures it against the same
+ * chain as real calls). The remaining members, toChars() and toString(),
+ * live here.
+ *
+ * By default this file is compiled once, into calculator.cpp, giving those
+ * members a stable ABI. Defining `CALCULATOR_HEADER_ONLY` makes
+ * calculator.h include it instead, with the definitions marked `inline`,
+ * which also lets BasicCalculator be used with value types that no .cpp
+ * file instantiates.
+ *
+ * The macro must be defined identically for every translation unit of a
+ * program, including calculator.cpp, which is still needed for the bulk
+ * kernels.
+ *
+ * @example
+ * ```cpp
+ * #define CALCULATOR_HEADER_ONLY
+ * #include "calculator.h"
+ * ```
+ */
+
+#ifndef CALCULATOR_INLINE_H
+#define CALCULATOR_INLINE_H
+
+#include "calculator.h"
+#include <algorithm>
+#include <cstddef>
+
+template <typename T, typename DivPolicy>
+CALCULATOR_INLINE std::to_chars_result BasicCalculator<T, DivPolicy>::toChars(char* first, char* last, int precision) const {
+    return MathUtils::NumericTraits<T>::toChars(first, last, value_, precision);
+}
+
+template <typename T, typename DivPolicy>
+CALCULATOR_INLINE std::string BasicCalculator<T, DivPolicy>::toString(int precision) const {
+    char buffer[128];
+    auto [end, ec] = toChars(buffer, buffer + sizeof(buffer), precision);
+    if (ec == std::errc()) {
+        return std::string(buffer, end);
+    }
+    // Huge magnitudes or precisions: grow until the text fits
+    std::string text(2 * sizeof(buffer) + static_cast<std::size_t>(std::max(precision, 0)), '\0');
+    while (true) {
+        auto result = toChars(text.data(), text.data() + text.size(), precision);
+        if (result.ec == std::errc()) {
+            text.resize(result.ptr - text.data());
+            return text;
+        }
+        text.resize(2 * text.size());
+    }
+}
+
+#endif // CALCULATOR_INLINE_H
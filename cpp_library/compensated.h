@@ -0,0 +1,144 @@
+/**
+ * @file compensated.h
+ * @brief Compensated (Kahan-style) summation as a Calculator value type
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Adding 10^8 values into a plain double loses the low bits of every
+ * addition. CompensatedDouble carries the rounding error of each addition
+ * in a second double and folds it back in when the value is read, so long
+ * runs of add() and subtract() stay accurate to about twice the double
+ * precision at a small constant cost, without resorting to long double.
+ *
+ * @example
+ * ```cpp
+ * CompensatedCalculator total;
+ * for (int i = 0; i < 100'000'000; ++i) {
+ *     total.add(0.1);
+ * }
+ * double sum = total.getValue().value(); // 10000000.0 to the last bit
+ * ```
+ */
+
+#ifndef COMPENSATED_H
+#define COMPENSATED_H
+
+#include "numeric_traits.h"
+#include <charconv>
+
+namespace MathUtils {
+    /**
+     * @brief Error-free sum: s + e == a + b exactly, with s = fl(a + b)
+     * @param a First addend
+     * @param b Second addend
+     * @param e Receives the rounding error of the sum
+     * @return Rounded sum
+     *
+     * Knuth's branch-free TwoSum, so it vectorizes. Exact unless the sum
+     * overflows.
+     */
+    constexpr double twoSum(double a, double b, double& e) {
+        double s = a + b;
+        double b_virtual = s - a;
+        e = (a - (s - b_virtual)) + (b - b_virtual);
+        return s;
+    }
+
+    /**
+     * @class CompensatedDouble
+     * @brief A double sum plus the accumulated rounding error of its additions
+     *
+     * Addition and subtraction go through twoSum() and add the error to a
+     * running compensation term. Multiplication and division work on the
+     * compensated value() and start a new compensation, so they round like
+     * plain double arithmetic.
+     *
+     * Converts implicitly from double, which lets it stand in for the
+     * value type of BasicCalculator (see CompensatedCalculator); converting
+     * back is explicit, through value().
+     */
+    class CompensatedDouble {
+    private:
+        double sum_ = 0.0;          ///< Rounded running sum
+        double compensation_ = 0.0; ///< Accumulated rounding error of sum_
+
+        constexpr CompensatedDouble(double sum, double compensation)
+            : sum_(sum), compensation_(compensation) {
+        }
+
+    public:
+        /**
+         * @brief Creates a compensated value with no error term
+         * @param value Initial value (default: 0.0)
+         */
+        constexpr CompensatedDouble(double value = 0.0) : sum_(value) {
+        }
+
+        /**
+         * @brief Gets the compensated value
+         * @return Running sum with the error term folded in
+         */
+        constexpr double value() const {
+            return sum_ + compensation_;
+        }
+
+        /**
+         * @brief Converts to double, as value()
+         */
+        constexpr explicit operator double() const {
+            return value();
+        }
+
+        constexpr CompensatedDouble operator-() const {
+            return CompensatedDouble(-sum_, -compensation_);
+        }
+
+        friend constexpr CompensatedDouble operator+(const CompensatedDouble& a, const CompensatedDouble& b) {
+            double error = 0.0;
+            double sum = twoSum(a.sum_, b.sum_, error);
+            return CompensatedDouble(sum, a.compensation_ + b.compensation_ + error);
+        }
+
+        friend constexpr CompensatedDouble operator-(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return a + (-b);
+        }
+
+        friend constexpr CompensatedDouble operator*(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return CompensatedDouble(a.value() * b.value());
+        }
+
+        friend constexpr CompensatedDouble operator/(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return CompensatedDouble(a.value() / b.value());
+        }
+
+        friend constexpr bool operator==(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return a.value() == b.value();
+        }
+
+        friend constexpr bool operator<(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return a.value() < b.value();
+        }
+    };
+
+    /**
+     * @brief Numeric rules for CompensatedDouble: those of double, applied
+     *        to the compensated value
+     */
+    template <>
+    struct NumericTraits<CompensatedDouble> {
+        static constexpr bool isNearZero(const CompensatedDouble& b) {
+            return NumericTraits<double>::isNearZero(b.value());
+        }
+
+        static constexpr bool approximatelyEqual(const CompensatedDouble& a, const CompensatedDouble& b) {
+            return NumericTraits<double>::approximatelyEqual(a.value(), b.value());
+        }
+
+        static std::to_chars_result toChars(char* first, char* last, const CompensatedDouble& value, int precision) {
+            return NumericTraits<double>::toChars(first, last, value.value(), precision);
+        }
+    };
+}
+
+#endif // COMPENSATED_H
@@ -0,0 +1,16 @@
+/**
+ * @file compensated_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on compensated sums
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "compensated_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::CompensatedDouble, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::CompensatedDouble, MathUtils::IeeeDivision>;
@@ -0,0 +1,37 @@
+/**
+ * @file compensated_calculator.h
+ * @brief BasicCalculator on the compensated sums of compensated.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Kept out of calculator.h so that code using only Calculator does not
+ * parse the compensated types.
+ *
+ * @example
+ * ```cpp
+ * #include "compensated_calculator.h"
+ *
+ * CompensatedCalculator total;
+ * for (double x : samples) {
+ *     total.add(x);
+ * }
+ * double sum = total.getValue().value();
+ * ```
+ */
+
+#ifndef COMPENSATED_CALCULATOR_H
+#define COMPENSATED_CALCULATOR_H
+
+#include "calculator.h"
+#include "compensated.h"
+
+/**
+ * @brief Calculator whose add() and subtract() carry a compensation term
+ *
+ * Stays accurate over very long chains of additions, see compensated.h.
+ * Read the result with `getValue().value()`.
+ */
+using CompensatedCalculator = BasicCalculator<MathUtils::CompensatedDouble, MathUtils::ThrowingDivision>;
+
+#endif // COMPENSATED_CALCULATOR_H
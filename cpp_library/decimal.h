@@ -0,0 +1,517 @@
+/**
+ * @file decimal.h
+ * @brief Fixed-point decimals: exact cents (or any fixed number of places)
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A decimal with scale S stores value * 10^S in an integer, so 0.10 is
+ * exactly 10 units at scale 2 and a chain of additions never drifts.
+ * Addition and subtraction are plain integer operations. Multiplication
+ * and division round once, to the scale of the type, with the rounding
+ * mode chosen as a template argument; their intermediates are 128 bits
+ * wide for Decimal64 and 256 bits for Decimal128, so no precision is lost
+ * before that single rounding.
+ *
+ * Results must fit in the integer, as for built-in integers: Decimal64 at
+ * scale 2 holds ±92 233 720 368 547 758.07, and overflow is not detected.
+ *
+ * DecimalCalculator (decimal_calculator.h) runs the fluent API on
+ * Decimal64, and DecimalBatch (decimal_batch.h) applies it to whole ledger
+ * columns. Requires a compiler with __int128 (GCC, Clang).
+ *
+ * @example
+ * ```cpp
+ * using Money = MathUtils::Decimal64<2>;
+ * Money price("19.99");
+ * Money total = price * 3 - Money("0.97"); // 59.00
+ * Money share = total / 7;                 // 8.43, rounded once
+ * std::string text = share.toString();     // "8.43"
+ * ```
+ */
+
+#ifndef DECIMAL_H
+#define DECIMAL_H
+
+#include "numeric_traits.h"
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace MathUtils {
+    /**
+     * @brief How a result between two representable decimals is rounded
+     */
+    enum class RoundingMode {
+        HalfEven,         ///< To nearest, ties to the even neighbour (banker's rounding)
+        HalfAwayFromZero, ///< To nearest, ties away from zero (commercial rounding)
+        TowardZero,       ///< Drops the extra digits
+        Floor,            ///< Toward negative infinity
+        Ceiling           ///< Toward positive infinity
+    };
+
+    /// @cond INTERNAL
+    namespace detail {
+        __extension__ typedef __int128 Int128;
+        __extension__ typedef unsigned __int128 UInt128;
+
+        constexpr std::uint64_t powerOfTen(int exponent) {
+            std::uint64_t power = 1;
+            for (int i = 0; i < exponent; ++i) {
+                power *= 10;
+            }
+            return power;
+        }
+
+        template <typename Rep>
+        constexpr UInt128 magnitude(Rep value) {
+            return value < 0 ? UInt128(0) - static_cast<UInt128>(value) : static_cast<UInt128>(value);
+        }
+
+        /**
+         * Whether the magnitude of a truncated quotient goes up by one
+         * under Mode, given the remainder and divisor of the division
+         */
+        template <RoundingMode Mode>
+        constexpr bool roundsAway(UInt128 quotient, UInt128 remainder, UInt128 divisor, bool negative) {
+            if (remainder == 0) {
+                return false;
+            }
+            // remainder vs. divisor / 2, without overflowing
+            const UInt128 rest = divisor - remainder;
+            if constexpr (Mode == RoundingMode::HalfEven) {
+                return remainder > rest || (remainder == rest && (quotient & 1) != 0);
+            } else if constexpr (Mode == RoundingMode::HalfAwayFromZero) {
+                return remainder >= rest;
+            } else if constexpr (Mode == RoundingMode::TowardZero) {
+                return false;
+            } else if constexpr (Mode == RoundingMode::Floor) {
+                return negative;
+            } else {
+                return !negative;
+            }
+        }
+
+        /// hi * 2^128 + lo = a * b
+        constexpr void multiplyWide(UInt128 a, UInt128 b, UInt128& hi, UInt128& lo) {
+            const UInt128 mask = ~std::uint64_t(0);
+            const UInt128 low = (a & mask) * (b & mask);
+            const UInt128 middle1 = (a >> 64) * (b & mask);
+            const UInt128 middle2 = (a & mask) * (b >> 64);
+            const UInt128 high = (a >> 64) * (b >> 64);
+            const UInt128 middle = (low >> 64) + (middle1 & mask) + (middle2 & mask);
+            lo = (middle << 64) | (low & mask);
+            hi = high + (middle1 >> 64) + (middle2 >> 64) + (middle >> 64);
+        }
+
+        /// (hi * 2^128 + lo) / divisor for hi < divisor, so that the
+        /// quotient fits in 128 bits
+        constexpr UInt128 divideWide(UInt128 hi, UInt128 lo, UInt128 divisor, UInt128& remainder) {
+            if ((divisor >> 64) == 0) {
+                // Two 128-by-64-bit steps of schoolbook division
+                UInt128 t = (hi << 64) | (lo >> 64);
+                const UInt128 q1 = t / divisor;
+                t = ((t % divisor) << 64) | (lo & ~std::uint64_t(0));
+                remainder = t % divisor;
+                return (q1 << 64) | (t / divisor);
+            }
+            // Wide divisors only come from huge Decimal128 operands: one bit
+            // at a time
+            UInt128 quotient = 0;
+            for (int bit = 127; bit >= 0; --bit) {
+                const bool carry = (hi >> 127) != 0;
+                hi = (hi << 1) | ((lo >> bit) & 1);
+                quotient <<= 1;
+                if (carry || hi >= divisor) {
+                    hi -= divisor;
+                    quotient |= 1;
+                }
+            }
+            remainder = hi;
+            return quotient;
+        }
+    }
+    /// @endcond
+
+    /**
+     * @class BasicDecimal
+     * @brief A signed decimal with a fixed number of places
+     * @tparam Rep std::int64_t or __int128, holding value * 10^Scale
+     * @tparam Scale Number of decimal places, 0 to 18
+     * @tparam Rounding Rounding of multiply, divide, parsing and printing
+     *
+     * Converts implicitly from std::int64_t (whole units), which lets it
+     * stand in for the value type of BasicCalculator; use the string
+     * constructor or fromDouble() for fractions. Everything except
+     * fromDouble() and toDouble() is constexpr.
+     */
+    template <typename Rep, int Scale, RoundingMode Rounding = RoundingMode::HalfEven>
+    class BasicDecimal {
+        static_assert(Scale >= 0 && Scale <= 18, "the scale factor 10^Scale must fit in 64 bits");
+
+    public:
+        /// Number of decimal places
+        static constexpr int scale = Scale;
+
+        /// Rounding of multiply, divide, parsing and printing
+        static constexpr RoundingMode rounding = Rounding;
+
+        /// 10^Scale, the number of units in 1
+        static constexpr std::uint64_t unitsPerOne = detail::powerOfTen(Scale);
+
+    private:
+        Rep units_ = 0; ///< value * 10^Scale
+
+        static constexpr BasicDecimal fromMagnitude(detail::UInt128 magnitude, bool negative) {
+            const Rep units = static_cast<Rep>(magnitude);
+            return fromUnits(negative ? -units : units);
+        }
+
+    public:
+        /**
+         * @brief Creates zero
+         */
+        constexpr BasicDecimal() = default;
+
+        /**
+         * @brief Creates a decimal equal to a whole number
+         * @param value Whole units, e.g. 5 for 5.00
+         */
+        constexpr BasicDecimal(std::int64_t value) : units_(static_cast<Rep>(value) * static_cast<Rep>(unitsPerOne)) {
+        }
+
+        /**
+         * @brief Parses a decimal literal exactly
+         * @param text Optional sign, digits, and optionally '.' and more
+         *        digits, e.g. "-12.5" or ".25"; digits past the scale are
+         *        rounded with the type's rounding mode
+         * @throws std::invalid_argument if text is not a decimal literal
+         * @throws std::out_of_range if the value does not fit
+         */
+        constexpr explicit BasicDecimal(std::string_view text) {
+            bool negative = false;
+            if (!text.empty() && (text.front() == '-' || text.front() == '+')) {
+                negative = text.front() == '-';
+                text.remove_prefix(1);
+            }
+            detail::UInt128 magnitude = 0;
+            const detail::UInt128 limit = detail::magnitude(~Rep(0) ^ (Rep(1) << (8 * sizeof(Rep) - 1)));
+            int places = -1;  // decimal places read so far, -1 before the point
+            int digits = 0;
+            int first_dropped = 0;
+            bool rest_dropped = false;
+            for (char c : text) {
+                if (c == '.' && places < 0) {
+                    places = 0;
+                    continue;
+                }
+                if (c < '0' || c > '9') {
+                    throw std::invalid_argument("Invalid decimal literal");
+                }
+                ++digits;
+                if (places >= Scale) {
+                    // Past the scale: keep what rounding needs
+                    if (places++ == Scale) {
+                        first_dropped = c - '0';
+                    } else {
+                        rest_dropped |= c != '0';
+                    }
+                    continue;
+                }
+                const unsigned digit = static_cast<unsigned>(c - '0');
+                // Checked before multiplying: the product may wrap in UInt128
+                if (magnitude > (limit - digit) / 10) {
+                    throw std::out_of_range("Decimal literal out of range");
+                }
+                magnitude = magnitude * 10 + digit;
+                if (places >= 0) {
+                    ++places;
+                }
+            }
+            if (digits == 0) {
+                throw std::invalid_argument("Invalid decimal literal");
+            }
+            for (int i = places < 0 ? 0 : places; i < Scale; ++i) {
+                if (magnitude > limit / 10) {
+                    throw std::out_of_range("Decimal literal out of range");
+                }
+                magnitude *= 10;
+            }
+            // The dropped digits as a remainder over 20: twice the first
+            // digit, plus one if any later digit is nonzero, compares with
+            // half (10) exactly as the full tail would
+            magnitude += detail::roundsAway<Rounding>(magnitude, 2 * first_dropped + rest_dropped, 20, negative);
+            if (magnitude > limit) {
+                throw std::out_of_range("Decimal literal out of range");
+            }
+            units_ = fromMagnitude(magnitude, negative).units_;
+        }
+
+        /**
+         * @brief Creates a decimal from its scaled integer
+         * @param units value * 10^Scale, e.g. 1999 for 19.99 at scale 2
+         * @return The decimal
+         */
+        static constexpr BasicDecimal fromUnits(Rep units) {
+            BasicDecimal value;
+            value.units_ = units;
+            return value;
+        }
+
+        /**
+         * @brief Converts a double, rounding with the type's rounding mode
+         * @param value Value to convert; value * 10^Scale is computed in
+         *        double first, so 0.1 + 0.2 arrives as 0.30 at scale 2 but
+         *        the digits beyond double precision are not recovered
+         * @return Nearest decimal under the rounding mode
+         * @throws std::invalid_argument if value is infinite or NaN
+         * @throws std::out_of_range if the value does not fit
+         */
+        static BasicDecimal fromDouble(double value) {
+            if (!std::isfinite(value)) {
+                throw std::invalid_argument("Value is not finite");
+            }
+            double scaled = value * static_cast<double>(unitsPerOne);
+            if constexpr (Rounding == RoundingMode::HalfEven) {
+                scaled = std::nearbyint(scaled);
+            } else if constexpr (Rounding == RoundingMode::HalfAwayFromZero) {
+                scaled = std::round(scaled);
+            } else if constexpr (Rounding == RoundingMode::TowardZero) {
+                scaled = std::trunc(scaled);
+            } else if constexpr (Rounding == RoundingMode::Floor) {
+                scaled = std::floor(scaled);
+            } else {
+                scaled = std::ceil(scaled);
+            }
+            // 2^(8 sizeof(Rep) - 1) is exact in double and just out of range
+            const double bound = std::ldexp(1.0, 8 * sizeof(Rep) - 1);
+            if (!(scaled < bound && scaled > -bound)) {
+                throw std::out_of_range("Value out of range");
+            }
+            return fromUnits(static_cast<Rep>(scaled));
+        }
+
+        /**
+         * @brief Gets the scaled integer
+         * @return value * 10^Scale
+         */
+        constexpr Rep units() const {
+            return units_;
+        }
+
+        /**
+         * @brief Converts to double
+         * @return units() / 10^Scale, correctly rounded while |units()| < 2^53
+         */
+        double toDouble() const {
+            return static_cast<double>(units_) / static_cast<double>(unitsPerOne);
+        }
+
+        /**
+         * @brief Formats with all Scale places
+         * @return Text such as "-12.50"
+         */
+        std::string toString() const;
+
+        /**
+         * @brief Converts to another scale
+         * @tparam ToScale Scale of the result
+         * @return Same value, rounded with the rounding mode if ToScale < Scale
+         */
+        template <int ToScale>
+        constexpr BasicDecimal<Rep, ToScale, Rounding> rescaled() const {
+            using Target = BasicDecimal<Rep, ToScale, Rounding>;
+            if constexpr (ToScale >= Scale) {
+                return Target::fromUnits(units_ * static_cast<Rep>(detail::powerOfTen(ToScale - Scale)));
+            } else {
+                constexpr std::uint64_t divisor = detail::powerOfTen(Scale - ToScale);
+                const detail::UInt128 magnitude = detail::magnitude(units_);
+                const detail::UInt128 quotient = magnitude / divisor;
+                const bool away = detail::roundsAway<Rounding>(quotient, magnitude % divisor, divisor, units_ < 0);
+                const Rep units = static_cast<Rep>(quotient + away);
+                return Target::fromUnits(units_ < 0 ? -units : units);
+            }
+        }
+
+        constexpr BasicDecimal operator-() const {
+            return fromUnits(-units_);
+        }
+
+        friend constexpr BasicDecimal operator+(BasicDecimal a, BasicDecimal b) {
+            return fromUnits(a.units_ + b.units_);
+        }
+
+        friend constexpr BasicDecimal operator-(BasicDecimal a, BasicDecimal b) {
+            return fromUnits(a.units_ - b.units_);
+        }
+
+        /// Exact product rounded once to the scale
+        friend constexpr BasicDecimal operator*(BasicDecimal a, BasicDecimal b) {
+            using detail::UInt128;
+            const bool negative = (a.units_ < 0) != (b.units_ < 0);
+            const UInt128 x = detail::magnitude(a.units_);
+            const UInt128 y = detail::magnitude(b.units_);
+            UInt128 quotient = 0;
+            UInt128 remainder = 0;
+            if ((x >> 64) == 0 && (y >> 64) == 0) {
+                const UInt128 product = x * y;
+                if ((product >> 64) == 0) {
+                    // 64-bit division by a constant compiles to a multiply
+                    const auto narrow = static_cast<std::uint64_t>(product);
+                    quotient = narrow / unitsPerOne;
+                    remainder = narrow % unitsPerOne;
+                } else {
+                    quotient = product / unitsPerOne;
+                    remainder = product % unitsPerOne;
+                }
+            } else {
+                UInt128 hi = 0;
+                UInt128 lo = 0;
+                detail::multiplyWide(x, y, hi, lo);
+                quotient = detail::divideWide(hi, lo, unitsPerOne, remainder);
+            }
+            quotient += detail::roundsAway<Rounding>(quotient, remainder, unitsPerOne, negative);
+            return fromMagnitude(quotient, negative);
+        }
+
+        /// Exact quotient rounded once to the scale
+        /// @throws std::invalid_argument if b is zero
+        friend constexpr BasicDecimal operator/(BasicDecimal a, BasicDecimal b) {
+            using detail::UInt128;
+            if (b.units_ == 0) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+            const bool negative = (a.units_ < 0) != (b.units_ < 0);
+            const UInt128 x = detail::magnitude(a.units_);
+            const UInt128 y = detail::magnitude(b.units_);
+            UInt128 quotient = 0;
+            UInt128 remainder = 0;
+            if ((x >> 64) == 0) {
+                // x * 10^Scale < 2^124
+                const UInt128 scaled = x * unitsPerOne;
+                if ((scaled >> 64) == 0 && (y >> 64) == 0) {
+                    const auto narrow = static_cast<std::uint64_t>(scaled);
+                    const auto divisor = static_cast<std::uint64_t>(y);
+                    quotient = narrow / divisor;
+                    remainder = narrow % divisor;
+                } else {
+                    quotient = scaled / y;
+                    remainder = scaled % y;
+                }
+            } else {
+                UInt128 hi = 0;
+                UInt128 lo = 0;
+                detail::multiplyWide(x, unitsPerOne, hi, lo);
+                quotient = detail::divideWide(hi, lo, y, remainder);
+            }
+            quotient += detail::roundsAway<Rounding>(quotient, remainder, y, negative);
+            return fromMagnitude(quotient, negative);
+        }
+
+        constexpr BasicDecimal& operator+=(BasicDecimal other) {
+            return *this = *this + other;
+        }
+
+        constexpr BasicDecimal& operator-=(BasicDecimal other) {
+            return *this = *this - other;
+        }
+
+        constexpr BasicDecimal& operator*=(BasicDecimal other) {
+            return *this = *this * other;
+        }
+
+        constexpr BasicDecimal& operator/=(BasicDecimal other) {
+            return *this = *this / other;
+        }
+
+        friend constexpr bool operator==(BasicDecimal a, BasicDecimal b) = default;
+        friend constexpr auto operator<=>(BasicDecimal a, BasicDecimal b) = default;
+    };
+
+    /**
+     * @brief Decimal stored in 64 bits: up to 18 significant digits
+     */
+    template <int Scale, RoundingMode Rounding = RoundingMode::HalfEven>
+    using Decimal64 = BasicDecimal<std::int64_t, Scale, Rounding>;
+
+    /**
+     * @brief Decimal stored in 128 bits: up to 38 significant digits
+     */
+    template <int Scale, RoundingMode Rounding = RoundingMode::HalfEven>
+    using Decimal128 = BasicDecimal<detail::Int128, Scale, Rounding>;
+
+    /**
+     * @brief Numeric rules for decimals: exact, printed straight from the
+     *        integer
+     *
+     * toChars() rounds to `precision` places with the type's rounding mode
+     * when precision < Scale and pads with zeros beyond Scale; no double
+     * is involved.
+     */
+    template <typename Rep, int Scale, RoundingMode Rounding>
+    struct NumericTraits<BasicDecimal<Rep, Scale, Rounding>> {
+        using Decimal = BasicDecimal<Rep, Scale, Rounding>;
+
+        static constexpr bool isNearZero(const Decimal& b) {
+            return b.units() == 0;
+        }
+
+        static constexpr bool approximatelyEqual(const Decimal& a, const Decimal& b) {
+            return a == b;
+        }
+
+        static constexpr std::to_chars_result toChars(char* first, char* last, const Decimal& value, int precision) {
+            precision = precision < 0 ? 0 : precision;
+            const bool negative = value.units() < 0;
+            detail::UInt128 digits = detail::magnitude(value.units());
+            const int places = precision < Scale ? precision : Scale;
+            if (places < Scale) {
+                const std::uint64_t divisor = detail::powerOfTen(Scale - places);
+                const detail::UInt128 quotient = digits / divisor;
+                digits = quotient + detail::roundsAway<Rounding>(quotient, digits % divisor, divisor, negative);
+            }
+
+            char reversed[48] = {};
+            int count = 0;
+            do {
+                reversed[count++] = static_cast<char>('0' + static_cast<int>(digits % 10));
+                digits /= 10;
+            } while (digits != 0 || count <= places);
+
+            if (last - first < negative + count + (precision > 0) + (precision - places)) {
+                return {last, std::errc::value_too_large};
+            }
+            if (negative) {
+                *first++ = '-';
+            }
+            while (count > 0) {
+                if (count == places) {
+                    *first++ = '.';
+                }
+                *first++ = reversed[--count];
+            }
+            if (precision > places) {
+                if (places == 0) {
+                    *first++ = '.';
+                }
+                for (int i = places; i < precision; ++i) {
+                    *first++ = '0';
+                }
+            }
+            return {first, std::errc()};
+        }
+    };
+
+    template <typename Rep, int Scale, RoundingMode Rounding>
+    std::string BasicDecimal<Rep, Scale, Rounding>::toString() const {
+        char buffer[48];
+        auto result = NumericTraits<BasicDecimal>::toChars(buffer, buffer + sizeof(buffer), *this, Scale);
+        return std::string(buffer, result.ptr);
+    }
+}
+
+#endif // DECIMAL_H
@@ -0,0 +1,309 @@
+/**
+ * @file decimal_batch.h
+ * @brief A ledger column of fixed-point decimals stored as one integer array
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * DecimalBatch is the Decimal64 counterpart of CalculatorBatch. The lanes
+ * are the scaled integers of the decimals (cents at scale 2) in one
+ * SIMD-aligned std::int64_t array, so adding a fee to every row or summing
+ * the column is plain integer vector arithmetic: 2 (SSE2), 4 (AVX2) or 8
+ * (AVX-512) lanes per instruction, exact, and the same total at every
+ * level.
+ *
+ * Multiplication and division need the 128-bit product and the rounding
+ * of Decimal64, for which x86 has no vector instructions; they run lane
+ * by lane through the Decimal64 operators.
+ *
+ * @example
+ * ```cpp
+ * using Money = MathUtils::Decimal64<2>;
+ * DecimalBatch<2> amounts(rows);           // one lane per ledger row
+ * amounts.add(Money("0.30")).multiply(Money("1.19"));
+ * Money total = amounts.sum();
+ * DecimalBatch<4> precise = amounts.rescaled<4>();
+ * ```
+ */
+
+#ifndef DECIMAL_BATCH_H
+#define DECIMAL_BATCH_H
+
+#include "calculator_batch.h"
+#include "decimal.h"
+#include "decimal_calculator.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class DecimalBatch
+ * @brief A fixed number of independent Decimal64 values, one per lane
+ * @tparam Scale Number of decimal places of every lane
+ * @tparam Rounding Rounding of multiply() and divide()
+ *
+ * Every operation applies to all lanes, taking either one decimal operand
+ * for every lane or another batch of the same size. Lane i holds exactly
+ * what the Decimal64 operators give; as for them, results must fit and
+ * overflow is not detected.
+ */
+template <int Scale, MathUtils::RoundingMode Rounding = MathUtils::RoundingMode::HalfEven>
+class DecimalBatch {
+public:
+    /// Value of one lane
+    using Value = MathUtils::Decimal64<Scale, Rounding>;
+
+    /// Alignment in bytes of the unit array
+    static constexpr std::size_t kAlignment = CalculatorBatch::kAlignment;
+
+private:
+    using Column = std::vector<std::int64_t, MathUtils::detail::AlignedAllocator<std::int64_t, kAlignment>>;
+
+    Column units_; ///< Scaled integer of every lane
+
+    template <int, MathUtils::RoundingMode>
+    friend class DecimalBatch;
+
+    static void checkSizes(std::size_t a, std::size_t b) {
+        if (a != b) {
+            throw std::invalid_argument("Array sizes do not match");
+        }
+    }
+
+    template <typename Operation>
+    DecimalBatch& forEachLane(Operation operation) {
+        for (std::int64_t& units : units_) {
+            units = operation(Value::fromUnits(units)).units();
+        }
+        return *this;
+    }
+
+public:
+    /**
+     * @brief Creates an empty batch
+     */
+    DecimalBatch() = default;
+
+    /**
+     * @brief Creates a batch with every lane set to the same value
+     * @param size Number of lanes
+     * @param initial_value Starting value of every lane (default: 0)
+     */
+    explicit DecimalBatch(std::size_t size, Value initial_value = 0) : units_(size, initial_value.units()) {
+    }
+
+    /**
+     * @brief Creates a batch from one starting value per lane
+     * @param values Starting values, copied in lane order
+     */
+    explicit DecimalBatch(std::span<const Value> values) : units_(values.size()) {
+        std::transform(values.begin(), values.end(), units_.begin(), [](Value value) { return value.units(); });
+    }
+
+    /**
+     * @brief Creates a batch from scaled integers, e.g. a column of cents
+     * @param units value * 10^Scale of every lane, copied in lane order
+     * @return The batch
+     */
+    static DecimalBatch fromUnits(std::span<const std::int64_t> units) {
+        DecimalBatch batch;
+        batch.units_.assign(units.begin(), units.end());
+        return batch;
+    }
+
+    /**
+     * @brief Gets the number of lanes
+     * @return Lane count
+     */
+    std::size_t size() const {
+        return units_.size();
+    }
+
+    /**
+     * @brief Checks whether the batch has no lanes
+     * @return True if size() == 0
+     */
+    bool empty() const {
+        return units_.empty();
+    }
+
+    /**
+     * @brief Gets the value of one lane
+     * @param index Lane index, must be below size()
+     * @return Current value of the lane
+     */
+    Value operator[](std::size_t index) const {
+        return Value::fromUnits(units_[index]);
+    }
+
+    /**
+     * @brief Gets the scaled integers of all lanes
+     * @return Read-only view of the aligned array
+     */
+    std::span<const std::int64_t> units() const {
+        return units_;
+    }
+
+    /**
+     * @brief Sets every lane to the same value
+     * @param value New value
+     * @return Reference to this batch for chaining
+     */
+    DecimalBatch& setValue(Value value) {
+        std::fill(units_.begin(), units_.end(), value.units());
+        return *this;
+    }
+
+    /**
+     * @brief Adds a value to every lane
+     * @param value Value to add
+     * @return Reference to this batch for chaining
+     */
+    DecimalBatch& add(Value value) {
+        using namespace MathUtils::simd::detail;
+        bulkKernels().int64ArrayScalar[Add](units_.data(), value.units(), size());
+        return *this;
+    }
+
+    /**
+     * @brief Adds the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DecimalBatch& add(const DecimalBatch& values) {
+        using namespace MathUtils::simd::detail;
+        checkSizes(size(), values.size());
+        bulkKernels().int64ArrayArray[Add](units_.data(), values.units_.data(), size());
+        return *this;
+    }
+
+    /**
+     * @brief Subtracts a value from every lane
+     * @param value Value to subtract
+     * @return Reference to this batch for chaining
+     */
+    DecimalBatch& subtract(Value value) {
+        using namespace MathUtils::simd::detail;
+        bulkKernels().int64ArrayScalar[Subtract](units_.data(), value.units(), size());
+        return *this;
+    }
+
+    /**
+     * @brief Subtracts the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DecimalBatch& subtract(const DecimalBatch& values) {
+        using namespace MathUtils::simd::detail;
+        checkSizes(size(), values.size());
+        bulkKernels().int64ArrayArray[Subtract](units_.data(), values.units_.data(), size());
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies every lane by a value, rounding each product once
+     * @param value Value to multiply by
+     * @return Reference to this batch for chaining
+     */
+    DecimalBatch& multiply(Value value) {
+        return forEachLane([value](Value lane) { return lane * value; });
+    }
+
+    /**
+     * @brief Multiplies each lane by the matching lane of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DecimalBatch& multiply(const DecimalBatch& values) {
+        checkSizes(size(), values.size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            units_[i] = ((*this)[i] * values[i]).units();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Divides every lane by a value, rounding each quotient once
+     * @param value Value to divide by
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if value is zero
+     */
+    DecimalBatch& divide(Value value) {
+        if (value.units() == 0) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        return forEachLane([value](Value lane) { return lane / value; });
+    }
+
+    /**
+     * @brief Divides each lane by the matching lane of another batch
+     * @param values Batch with one divisor per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if the sizes differ or any divisor is zero
+     *
+     * All divisors are validated first, so on an exception no lane has
+     * changed.
+     */
+    DecimalBatch& divide(const DecimalBatch& values) {
+        checkSizes(size(), values.size());
+        if (std::find(values.units_.begin(), values.units_.end(), 0) != values.units_.end()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        for (std::size_t i = 0; i < size(); ++i) {
+            units_[i] = ((*this)[i] / values[i]).units();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Resets every lane to zero
+     * @return Reference to this batch for chaining
+     */
+    DecimalBatch& reset() {
+        return setValue(0);
+    }
+
+    /**
+     * @brief Adds up all lanes exactly
+     * @return Total of the column, which must fit like any other result
+     */
+    Value sum() const {
+        return Value::fromUnits(MathUtils::simd::detail::bulkKernels().int64Sum(units_.data(), size()));
+    }
+
+    /**
+     * @brief Converts every lane to another scale
+     * @tparam ToScale Scale of the result
+     * @return New batch, rounded with the rounding mode if ToScale < Scale
+     */
+    template <int ToScale>
+    DecimalBatch<ToScale, Rounding> rescaled() const {
+        DecimalBatch<ToScale, Rounding> result(size());
+        std::transform(units_.begin(), units_.end(), result.units_.begin(), [](std::int64_t lane) {
+            return Value::fromUnits(lane).template rescaled<ToScale>().units();
+        });
+        return result;
+    }
+
+    /**
+     * @brief Copies the lanes out as individual calculators
+     * @return One DecimalCalculator per lane, in lane order
+     */
+    std::vector<DecimalCalculator<Scale, Rounding>> toCalculators() const {
+        std::vector<DecimalCalculator<Scale, Rounding>> calculators;
+        calculators.reserve(size());
+        for (std::int64_t units : units_) {
+            calculators.emplace_back(Value::fromUnits(units));
+        }
+        return calculators;
+    }
+};
+
+#endif // DECIMAL_BATCH_H
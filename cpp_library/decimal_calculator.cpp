@@ -0,0 +1,17 @@
+/**
+ * @file decimal_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on fixed-point decimals
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "decimal_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::Decimal64<2>, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::Decimal64<4>, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::Decimal128<4>, MathUtils::ThrowingDivision>;
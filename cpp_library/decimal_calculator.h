@@ -0,0 +1,46 @@
+/**
+ * @file decimal_calculator.h
+ * @brief BasicCalculator on the fixed-point decimals of decimal.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Separate from calculator.h because decimal.h needs a 128-bit integer
+ * (unsigned __int128), which not every compiler provides; code that only
+ * uses Calculator does not depend on it.
+ *
+ * @example
+ * ```cpp
+ * #include "decimal_calculator.h"
+ *
+ * DecimalCalculator<2> price(MathUtils::Decimal64<2>("19.99"));
+ * price.multiply(3); // 59.97
+ * ```
+ */
+
+#ifndef DECIMAL_CALCULATOR_H
+#define DECIMAL_CALCULATOR_H
+
+#include "calculator.h"
+#include "decimal.h"
+
+/**
+ * @brief Calculator on fixed-point decimals, see decimal.h
+ * @tparam Scale Number of decimal places, e.g. 2 for cents
+ * @tparam Rounding Rounding of multiply() and divide()
+ *
+ * add() and subtract() are exact; multiply() and divide() round once to
+ * Scale places. Scales 2 and 4 with the default rounding are
+ * instantiated in decimal_calculator.cpp, as is
+ * BasicCalculator<MathUtils::Decimal128<4>>.
+ *
+ * @example
+ * ```cpp
+ * DecimalCalculator<2> ledger(MathUtils::Decimal64<2>("100.00"));
+ * ledger.divide(3).multiply(3); // 99.99: each step rounds to cents
+ * ```
+ */
+template <int Scale, MathUtils::RoundingMode Rounding = MathUtils::RoundingMode::HalfEven>
+using DecimalCalculator = BasicCalculator<MathUtils::Decimal64<Scale, Rounding>, MathUtils::ThrowingDivision>;
+
+#endif // DECIMAL_CALCULATOR_H
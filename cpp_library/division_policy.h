@@ -0,0 +1,158 @@
+/**
+ * @file division_policy.h
+ * @brief Compile-time policies for division by a near-zero divisor
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A division policy decides what happens when the divisor is zero for its
+ * type, as judged by NumericTraits<T>::isNearZero. It is a type with a
+ * static member template `T divide(T a, T b)` and is passed as a template
+ * argument to BasicCalculator and MathUtils::divide, so the check is
+ * resolved at compile time and vanishes entirely from builds that select
+ * IeeeDivision.
+ *
+ * @example
+ * ```cpp
+ * BasicCalculator<double, MathUtils::IeeeDivision> calc(1.0);
+ * calc.divide(0.0); // value = inf, nothing thrown, no zero check compiled in
+ *
+ * double q = MathUtils::divide<MathUtils::SaturatingDivision>(1.0, 0.0); // q = DBL_MAX
+ * ```
+ */
+
+#ifndef DIVISION_POLICY_H
+#define DIVISION_POLICY_H
+
+#include "numeric_traits.h"
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace MathUtils {
+    /**
+     * @brief Throws std::invalid_argument on a near-zero divisor
+     *
+     * The historical behaviour of MathUtils::divide and Calculator::divide.
+     */
+    struct ThrowingDivision {
+        /**
+         * @brief Divides a by b
+         * @throws std::invalid_argument if NumericTraits<T>::isNearZero(b)
+         */
+        template <typename T>
+        static constexpr T divide(T a, T b) {
+            if (NumericTraits<T>::isNearZero(b)) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+            return a / b;
+        }
+    };
+
+    /**
+     * @brief Plain IEEE 754 division with no zero check
+     *
+     * Division by zero yields ±inf, and 0/0 yields NaN. Only floating-point
+     * types qualify: integer division by zero is undefined behaviour.
+     */
+    struct IeeeDivision {
+        /**
+         * @brief Divides a by b
+         */
+        template <typename T>
+        static constexpr T divide(T a, T b) {
+            static_assert(!std::is_integral_v<T>, "IeeeDivision requires a floating-point type");
+            return a / b;
+        }
+    };
+
+    /**
+     * @brief Clamps the quotient of a near-zero divisor to the finite range
+     *
+     * A near-zero divisor yields the largest finite value of the type with
+     * the sign of a / b (±DBL_MAX for double), or 0 when the dividend is 0.
+     * For signed integers the one overflowing quotient, min / -1, also
+     * saturates to max. Other divisions are unchanged.
+     */
+    struct SaturatingDivision {
+    private:
+        template <typename T>
+        static constexpr bool negative(T x) {
+            if constexpr (std::is_floating_point_v<T>) {
+                // Sign bit of double(x): the conversion keeps the sign of
+                // zeros and underflowing values, and std::bit_cast, unlike
+                // std::signbit, is usable in constant expressions
+                return (std::bit_cast<std::uint64_t>(static_cast<double>(x)) >> 63) != 0;
+            } else {
+                return x < T(0);
+            }
+        }
+
+    public:
+        /**
+         * @brief Divides a by b, saturating instead of overflowing
+         */
+        template <typename T>
+        static constexpr T divide(T a, T b) {
+            if (NumericTraits<T>::isNearZero(b)) {
+                if (a == T(0) || a != a) {
+                    return a == T(0) ? T(0) : a; // zero or NaN dividend
+                }
+                T limit = std::numeric_limits<T>::max();
+                return negative(a) != negative(b) ? T(-limit) : limit;
+            }
+            if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+                if (a == std::numeric_limits<T>::min() && b == T(-1)) {
+                    return std::numeric_limits<T>::max();
+                }
+            }
+            return a / b;
+        }
+    };
+
+    /**
+     * @brief Leaves the dividend unchanged on a near-zero divisor
+     *
+     * The non-throwing policy: a near-zero divisor yields a unchanged
+     * instead of a quotient. A BasicCalculator with this policy also
+     * latches MathError::DivisionByZero, reported by hasError() and
+     * result(), so a whole chain runs without exceptions or branches on the
+     * caller's side and is checked once at the end (see
+     * LatchingCalculator).
+     */
+    struct LatchingDivision {
+        /**
+         * @brief Divides a by b, or returns a if b is zero for its type
+         */
+        template <typename T>
+        static constexpr T divide(T a, T b) {
+            if (NumericTraits<T>::isNearZero(b)) {
+                return a;
+            }
+            return a / b;
+        }
+    };
+
+    /**
+     * @brief Divides first number by second number under a division policy
+     * @tparam DivPolicy ThrowingDivision, IeeeDivision, SaturatingDivision or
+     *         LatchingDivision
+     * @tparam T Value type, deduced from the arguments
+     * @param a Dividend (number to be divided)
+     * @param b Divisor (number to divide by)
+     * @return DivPolicy::divide(a, b)
+     *
+     * @example
+     * ```cpp
+     * double q = MathUtils::divide<MathUtils::IeeeDivision>(1.0, 0.0); // q = inf
+     * ```
+     */
+    template <typename DivPolicy, typename T>
+    constexpr T divide(T a, T b) {
+        return DivPolicy::divide(a, b);
+    }
+}
+
+#endif // DIVISION_POLICY_H
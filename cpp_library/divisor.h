@@ -0,0 +1,370 @@
+/**
+ * @file divisor.h
+ * @brief A divisor validated once and prepared for dividing many values
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Dividing a whole column by the same value pays for a hardware divide
+ * (13-20 cycles of latency, one issue every 4-16 cycles) and for the zero
+ * check on every element. A Divisor checks the divisor when it is built and
+ * replaces the division with cheaper operations where that gives the same
+ * quotient:
+ * - float and double store the rounded reciprocal r = 1/d. The quotient
+ *   q = a * r can be 1 ulp off, so it is corrected with the exact remainder
+ *   of a fused multiply-add: q + fma(-q, d, a) * r (Markstein). For a
+ *   correctly rounded r this is a / d correctly rounded, bit for bit.
+ * - Signed integers store a magic multiplier and shift (Granlund and
+ *   Montgomery, as in libdivide), turning a / d into a widening multiply,
+ *   a shift and a sign fix, several times faster than idiv.
+ * - Any other value type (Rational, BigInt, Decimal64, ...) divides as
+ *   usual; only the zero check moves out of the loop.
+ *
+ * MathUtils::divide(), BasicCalculator::divide() and the batch classes
+ * accept a Divisor wherever they accept a divisor value.
+ *
+ * @example
+ * ```cpp
+ * const MathUtils::Divisor<double> perUnit(units);   // throws once if units is zero
+ * for (double& price : prices) {
+ *     price = MathUtils::divide(price, perUnit);     // same bits as price / units
+ * }
+ * MathUtils::divide(prices, perUnit, prices);       // bulk, 4 or 8 lanes per step
+ *
+ * const MathUtils::Divisor<std::int64_t> bucket(60);
+ * std::int64_t minutes = bucket.divide(seconds);     // multiply and shift, no idiv
+ * ```
+ */
+
+#ifndef DIVISOR_H
+#define DIVISOR_H
+
+#include "numeric_traits.h"
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MathUtils {
+    /// @cond INTERNAL
+    namespace detail {
+        /// High 64 bits of the 128-bit product a * b
+        constexpr std::int64_t multiplyHigh(std::int64_t a, std::int64_t b) {
+#ifdef __SIZEOF_INT128__
+            __extension__ typedef __int128 Wide;
+            return static_cast<std::int64_t>((static_cast<Wide>(a) * static_cast<Wide>(b)) >> 64);
+#else
+            // Unsigned product from 32-bit halves, then subtract what the
+            // signs of a and b contribute to the high half
+            const std::uint64_t x = static_cast<std::uint64_t>(a);
+            const std::uint64_t y = static_cast<std::uint64_t>(b);
+            const std::uint64_t low = (x & 0xFFFFFFFFu) * (y & 0xFFFFFFFFu);
+            const std::uint64_t middle = (x >> 32) * (y & 0xFFFFFFFFu) + (low >> 32);
+            const std::uint64_t other = (x & 0xFFFFFFFFu) * (y >> 32) + (middle & 0xFFFFFFFFu);
+            std::uint64_t high = (x >> 32) * (y >> 32) + (middle >> 32) + (other >> 32);
+            if (a < 0) {
+                high -= y;
+            }
+            if (b < 0) {
+                high -= x;
+            }
+            return static_cast<std::int64_t>(high);
+#endif
+        }
+
+        /// True if fma() on T is a single instruction rather than a library call
+        template <typename T>
+        constexpr bool hasFastFma() {
+#ifdef __FP_FAST_FMA
+            if constexpr (std::is_same_v<T, double>) {
+                return true;
+            }
+#endif
+#ifdef __FP_FAST_FMAF
+            if constexpr (std::is_same_v<T, float>) {
+                return true;
+            }
+#endif
+            return false;
+        }
+
+        /// Magnitudes for which the reciprocal path of Divisor is exact
+        template <typename T>
+        struct ReciprocalRange;
+
+        template <>
+        struct ReciprocalRange<double> {
+            // 1/d is a correctly rounded normal number
+            static constexpr double minDivisor = 0x1p-1021;
+            static constexpr double maxDivisor = 0x1p1021;
+            // The remainder a - q * d is exact (no underflow), and the
+            // quotient stays clear of overflow
+            static constexpr double minOperand = 0x1p-968;
+            static constexpr double maxQuotient = 0x1p1022;
+        };
+
+        template <>
+        struct ReciprocalRange<float> {
+            static constexpr float minDivisor = 0x1p-125f;
+            static constexpr float maxDivisor = 0x1p125f;
+            static constexpr float minOperand = 0x1p-100f;
+            static constexpr float maxQuotient = 0x1p126f;
+        };
+    }
+    /// @endcond
+
+    /**
+     * @class Divisor
+     * @brief A non-zero divisor, checked once
+     * @tparam T Value type
+     *
+     * Construction throws on a divisor that NumericTraits<T>::isNearZero
+     * rejects; divide() then never checks again. This generic form divides
+     * with T's operator/. float, double, signed integers and BasicInteger
+     * (in integer.h) have faster specializations that give the same
+     * quotients.
+     */
+    template <typename T>
+    class Divisor {
+    public:
+        /**
+         * @brief Validates a divisor
+         * @param divisor Value to divide by
+         * @throws std::invalid_argument if divisor is zero
+         */
+        explicit constexpr Divisor(T divisor) : divisor_(std::move(divisor)) {
+            if (NumericTraits<T>::isNearZero(divisor_)) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+        }
+
+        /**
+         * @brief Gets the divisor
+         * @return Value divided by
+         */
+        constexpr const T& value() const {
+            return divisor_;
+        }
+
+        /**
+         * @brief Divides a value by the divisor
+         * @param dividend Value to divide
+         * @return dividend / value()
+         */
+        constexpr T divide(const T& dividend) const {
+            return dividend / divisor_;
+        }
+
+    private:
+        T divisor_; ///< Validated divisor
+    };
+
+    /**
+     * @brief Divisor of float or double, dividing by multiplying with the
+     *        reciprocal and one correction step
+     *
+     * divide() returns exactly dividend / value(), including the sign of
+     * zero, infinities and NaN. The multiply-and-correct path is taken when
+     * fma is a hardware instruction in this translation unit (-mfma,
+     * -march=haswell or later, and every AArch64 build) and the operands
+     * lie in the range where it is provably exact; otherwise, and for
+     * divisors beyond 2^±1021, divide() falls back to the hardware divide.
+     * The bulk MathUtils::divide() overload picks the FMA kernels at
+     * runtime regardless of compiler flags.
+     */
+    template <typename T>
+        requires(std::same_as<T, float> || std::same_as<T, double>)
+    class Divisor<T> {
+        using Range = detail::ReciprocalRange<T>;
+
+    public:
+        /**
+         * @brief Validates a divisor and computes its reciprocal
+         * @param divisor Value to divide by
+         * @throws std::invalid_argument if |divisor| < 1e-10
+         */
+        explicit constexpr Divisor(T divisor) : divisor_(divisor), reciprocal_(T(1) / divisor) {
+            if (NumericTraits<T>::isNearZero(divisor)) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+            const T magnitude = divisor < 0 ? -divisor : divisor;
+            exact_ = magnitude >= Range::minDivisor && magnitude <= Range::maxDivisor;
+        }
+
+        /**
+         * @brief Gets the divisor
+         * @return Value divided by
+         */
+        constexpr T value() const {
+            return divisor_;
+        }
+
+        /**
+         * @brief Gets the reciprocal
+         * @return 1 / value(), rounded to nearest
+         */
+        constexpr T reciprocal() const {
+            return reciprocal_;
+        }
+
+        /**
+         * @brief Checks whether the reciprocal can stand in for the divisor
+         * @return True if 2^-1021 <= |value()| <= 2^1021 (2^±125 for float),
+         *         so that 1 / value() is a normal number
+         */
+        constexpr bool hasExactReciprocal() const {
+            return exact_;
+        }
+
+        /**
+         * @brief Divides a value by the divisor
+         * @param dividend Value to divide
+         * @return dividend / value(), correctly rounded
+         */
+        constexpr T divide(T dividend) const {
+            if !consteval {
+                if constexpr (detail::hasFastFma<T>()) {
+                    const T quotient = dividend * reciprocal_;
+                    const T magnitude = std::abs(quotient);
+                    // False for zeros, infinities and NaN, which take the
+                    // division below
+                    if (exact_ && std::abs(dividend) >= Range::minOperand && magnitude >= Range::minOperand &&
+                        magnitude <= Range::maxQuotient) {
+                        return std::fma(std::fma(-quotient, divisor_, dividend), reciprocal_, quotient);
+                    }
+                }
+            }
+            return dividend / divisor_;
+        }
+
+    private:
+        T divisor_;         ///< Validated divisor
+        T reciprocal_;      ///< 1 / divisor_, rounded to nearest
+        bool exact_ = true; ///< Whether reciprocal_ is a normal number
+    };
+
+    /**
+     * @brief Divisor of a signed integer, dividing with a magic multiplier
+     *
+     * divide() truncates toward zero like the built-in operator. The one
+     * quotient that does not fit, min / -1, wraps to min instead of being
+     * undefined.
+     */
+    template <std::signed_integral T>
+    class Divisor<T> {
+        static_assert(sizeof(T) <= sizeof(std::int64_t), "Divisor supports integers of up to 64 bits");
+
+        using Unsigned = std::make_unsigned_t<T>;
+        static constexpr int kBits = std::numeric_limits<Unsigned>::digits;
+
+    public:
+        /**
+         * @brief Validates a divisor and computes its magic multiplier
+         * @param divisor Value to divide by
+         * @throws std::invalid_argument if divisor is zero
+         */
+        explicit constexpr Divisor(T divisor) : divisor_(divisor) {
+            if (divisor == 0) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+            if (divisor == 1 || divisor == -1) {
+                return; // magic_ == 0 marks these, see divide()
+            }
+            // Smallest shift p >= kBits - 1 for which 2^p / |divisor|,
+            // rounded up, divides every dividend exactly (Hacker's Delight,
+            // figure 10-1). All arithmetic is modulo 2^kBits.
+            const Unsigned top = Unsigned(1) << (kBits - 1);
+            const Unsigned absolute = divisor < 0 ? Unsigned(0) - Unsigned(divisor) : Unsigned(divisor);
+            const Unsigned t = top + (Unsigned(divisor) >> (kBits - 1));
+            const Unsigned absoluteLimit = t - 1 - t % absolute;
+            int p = kBits - 1;
+            Unsigned q1 = top / absoluteLimit;
+            Unsigned r1 = top - q1 * absoluteLimit;
+            Unsigned q2 = top / absolute;
+            Unsigned r2 = top - q2 * absolute;
+            Unsigned delta = 0;
+            do {
+                ++p;
+                q1 *= 2;
+                r1 *= 2;
+                if (r1 >= absoluteLimit) {
+                    ++q1;
+                    r1 -= absoluteLimit;
+                }
+                q2 *= 2;
+                r2 *= 2;
+                if (r2 >= absolute) {
+                    ++q2;
+                    r2 -= absolute;
+                }
+                delta = absolute - r2;
+            } while (q1 < delta || (q1 == delta && r1 == 0));
+            const Unsigned magic = q2 + 1;
+            magic_ = T(divisor < 0 ? Unsigned(0) - magic : magic);
+            shift_ = p - kBits;
+        }
+
+        /**
+         * @brief Gets the divisor
+         * @return Value divided by
+         */
+        constexpr T value() const {
+            return divisor_;
+        }
+
+        /**
+         * @brief Divides a value by the divisor
+         * @param dividend Value to divide
+         * @return dividend / value(), truncated toward zero
+         */
+        constexpr T divide(T dividend) const {
+            if (magic_ == 0) {
+                return divisor_ == 1 ? dividend : T(Unsigned(0) - Unsigned(dividend));
+            }
+            // High half of the product, then undo the sign the magic
+            // number picked up by wrapping into T
+            Unsigned high;
+            if constexpr (sizeof(T) < sizeof(std::int64_t)) {
+                high = Unsigned(T((std::int64_t(magic_) * std::int64_t(dividend)) >> kBits));
+            } else {
+                high = Unsigned(detail::multiplyHigh(magic_, dividend));
+            }
+            if (divisor_ > 0 && magic_ < 0) {
+                high += Unsigned(dividend);
+            } else if (divisor_ < 0 && magic_ > 0) {
+                high -= Unsigned(dividend);
+            }
+            const T quotient = T(high) >> shift_;
+            // Round a negative quotient toward zero
+            return T(Unsigned(quotient) + (Unsigned(quotient) >> (kBits - 1)));
+        }
+
+    private:
+        T divisor_;    ///< Validated divisor
+        T magic_ = 0;  ///< Multiplier, 0 for a divisor of ±1
+        int shift_ = 0; ///< Right shift applied to the high half
+    };
+
+    /**
+     * @brief Divides a number by a prepared divisor
+     * @tparam T Value type, deduced from the divisor
+     * @param a Dividend (number to be divided)
+     * @param b Divisor, validated when it was built
+     * @return Quotient of a divided by b, equal to a / b.value()
+     *
+     * @example
+     * ```cpp
+     * const MathUtils::Divisor<double> three(3.0);
+     * double q = MathUtils::divide(15.0, three); // q = 5.0
+     * ```
+     */
+    template <typename T>
+    constexpr T divide(std::type_identity_t<T> a, const Divisor<T>& b) {
+        return b.divide(a);
+    }
+}
+
+#endif // DIVISOR_H
@@ -0,0 +1,269 @@
+/**
+ * @file double_double.h
+ * @brief Double-double arithmetic: about 106 bits of precision from two doubles
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A DoubleDouble represents hi + lo, where lo is below half an ulp of hi,
+ * which gives about 32 significant decimal digits with the exponent range
+ * of double. Every operation is a short, branch-free sequence of error-free
+ * transformations (twoSum(), twoProd()) at roughly 10x to 20x the cost of
+ * plain double arithmetic, so it fills the gap between CompensatedDouble
+ * (accurate sums only) and arbitrary precision.
+ *
+ * DoubleDoubleCalculator (double_double_calculator.h) runs the fluent API
+ * on it, and DoubleDoubleBatch (double_double_batch.h) applies it to many
+ * lanes with vectorized kernels.
+ *
+ * @example
+ * ```cpp
+ * MathUtils::DoubleDouble third = MathUtils::DoubleDouble(1.0) / 3.0;
+ * MathUtils::DoubleDouble one = third * 3.0; // 1 to ~1e-32
+ * ```
+ */
+
+#ifndef DOUBLE_DOUBLE_H
+#define DOUBLE_DOUBLE_H
+
+#include "compensated.h"
+#include "numeric_traits.h"
+#include <charconv>
+#include <cmath>
+
+namespace MathUtils {
+    /**
+     * @brief Error-free sum for |a| >= |b|: s + e == a + b exactly
+     * @param a Larger addend (or a == 0)
+     * @param b Smaller addend
+     * @param e Receives the rounding error of the sum
+     * @return Rounded sum
+     *
+     * Dekker's Fast2Sum: three operations instead of the six of twoSum(),
+     * valid only under the magnitude precondition.
+     */
+    constexpr double fastTwoSum(double a, double b, double& e) {
+        double s = a + b;
+        e = b - (s - a);
+        return s;
+    }
+
+    /**
+     * @brief Error-free product: p + e == a * b exactly, with p = fl(a * b)
+     * @param a First factor
+     * @param b Second factor
+     * @param e Receives the rounding error of the product
+     * @return Rounded product
+     *
+     * One multiply and one fused multiply-add. Exact unless the product
+     * overflows or its error underflows.
+     */
+    constexpr double twoProd(double a, double b, double& e) {
+        double p = a * b;
+        e = std::fma(a, b, -p);
+        return p;
+    }
+
+    /**
+     * @class DoubleDouble
+     * @brief An unevaluated sum hi + lo of two non-overlapping doubles
+     *
+     * Addition, subtraction and multiplication have a relative error of
+     * a few units of 2^-106; division about 15 units. The algorithms are
+     * those of Joldes, Muller and Popescu, "Tight and rigorous error bounds
+     * for basic building blocks of double-word arithmetic" (2017):
+     * AccurateDWPlusDW, DWTimesDW3 and DWDivDW2. None of them branches, so
+     * the same code vectorizes in DoubleDoubleBatch.
+     *
+     * Converts implicitly from double, which lets it stand in for the value
+     * type of BasicCalculator (see DoubleDoubleCalculator); converting back
+     * is explicit, through value(). Infinities and NaN propagate through hi;
+     * lo is then meaningless.
+     */
+    class DoubleDouble {
+    private:
+        double hi_ = 0.0; ///< Leading part, the value rounded to double
+        double lo_ = 0.0; ///< Trailing part, |lo_| <= ulp(hi_) / 2
+
+    public:
+        /**
+         * @brief Creates a double-double equal to a double
+         * @param value Initial value (default: 0.0)
+         */
+        constexpr DoubleDouble(double value = 0.0) : hi_(value) {
+        }
+
+        /**
+         * @brief Creates a double-double from its two parts
+         * @param hi Leading part
+         * @param lo Trailing part; must satisfy |lo| <= ulp(hi) / 2, as the
+         *        parts of an existing value do
+         */
+        constexpr DoubleDouble(double hi, double lo) : hi_(hi), lo_(lo) {
+        }
+
+        /**
+         * @brief Gets the leading part
+         * @return hi, which is also the value rounded to double
+         */
+        constexpr double hi() const {
+            return hi_;
+        }
+
+        /**
+         * @brief Gets the trailing part
+         * @return lo
+         */
+        constexpr double lo() const {
+            return lo_;
+        }
+
+        /**
+         * @brief Gets the value rounded to double
+         * @return hi()
+         */
+        constexpr double value() const {
+            return hi_;
+        }
+
+        /**
+         * @brief Converts to double, as value()
+         */
+        constexpr explicit operator double() const {
+            return hi_;
+        }
+
+        constexpr DoubleDouble operator-() const {
+            return DoubleDouble(-hi_, -lo_);
+        }
+
+        friend constexpr DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) {
+            double e = 0.0;
+            double f = 0.0;
+            double s = twoSum(a.hi_, b.hi_, e);
+            double t = twoSum(a.lo_, b.lo_, f);
+            e += t;
+            s = fastTwoSum(s, e, e);
+            e += f;
+            s = fastTwoSum(s, e, e);
+            return DoubleDouble(s, e);
+        }
+
+        friend constexpr DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) {
+            return a + (-b);
+        }
+
+        friend constexpr DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) {
+            double e = 0.0;
+            double p = twoProd(a.hi_, b.hi_, e);
+            double cross = std::fma(a.lo_, b.hi_, a.hi_ * b.lo_);
+            e += cross;
+            p = fastTwoSum(p, e, e);
+            return DoubleDouble(p, e);
+        }
+
+        friend constexpr DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) {
+            // Quotient of the leading parts, then one correction from the
+            // exact remainder a - b * q
+            double q = a.hi_ / b.hi_;
+            double e = 0.0;
+            double r_hi = twoProd(b.hi_, q, e);
+            e = std::fma(b.lo_, q, e);
+            r_hi = fastTwoSum(r_hi, e, e);
+            double remainder = (a.hi_ - r_hi) + (a.lo_ - e);
+            double correction = remainder / b.hi_;
+            q = fastTwoSum(q, correction, correction);
+            return DoubleDouble(q, correction);
+        }
+
+        constexpr DoubleDouble& operator+=(const DoubleDouble& other) {
+            return *this = *this + other;
+        }
+
+        constexpr DoubleDouble& operator-=(const DoubleDouble& other) {
+            return *this = *this - other;
+        }
+
+        constexpr DoubleDouble& operator*=(const DoubleDouble& other) {
+            return *this = *this * other;
+        }
+
+        constexpr DoubleDouble& operator/=(const DoubleDouble& other) {
+            return *this = *this / other;
+        }
+
+        friend constexpr bool operator==(const DoubleDouble& a, const DoubleDouble& b) {
+            return a.hi_ == b.hi_ && a.lo_ == b.lo_;
+        }
+
+        friend constexpr bool operator<(const DoubleDouble& a, const DoubleDouble& b) {
+            return a.hi_ < b.hi_ || (a.hi_ == b.hi_ && a.lo_ < b.lo_);
+        }
+    };
+
+    /**
+     * @brief Numeric rules for DoubleDouble
+     *
+     * The zero threshold and equality tolerance are those of double,
+     * applied to the full double-double difference. toChars() prints all
+     * 32 digits, rounded to @p precision places, while precision <= 40 and
+     * |value| * 10^precision < 2^126; beyond that, which is past the digits
+     * the type carries anyway, it prints hi as a double.
+     */
+    template <>
+    struct NumericTraits<DoubleDouble> {
+        static constexpr bool isNearZero(const DoubleDouble& b) {
+            return NumericTraits<double>::isNearZero(b.hi());
+        }
+
+        static constexpr bool approximatelyEqual(const DoubleDouble& a, const DoubleDouble& b) {
+            return NumericTraits<double>::approximatelyEqual((a - b).hi(), 0.0);
+        }
+
+        static std::to_chars_result toChars(char* first, char* last, const DoubleDouble& value, int precision) {
+#ifdef __SIZEOF_INT128__
+            DoubleDouble scaled = std::signbit(value.hi()) ? -value : value;
+            for (int i = 0; i < precision; ++i) {
+                scaled *= 10.0;
+            }
+            // Both parts of scaled are below 2^126, so their floors convert
+            // to __int128 exactly; the fractional parts sum to [0, 2)
+            if (precision >= 0 && precision <= 40 && std::isfinite(scaled.hi()) && scaled.hi() < 0x1p126) {
+                __extension__ typedef __int128 Wide;
+                __extension__ typedef unsigned __int128 UnsignedWide;
+                double hi_floor = std::floor(scaled.hi());
+                double lo_floor = std::floor(scaled.lo());
+                double fraction = (scaled.hi() - hi_floor) + (scaled.lo() - lo_floor);
+                Wide rounded = static_cast<Wide>(hi_floor) + static_cast<Wide>(lo_floor) +
+                               static_cast<int>(fraction + 0.5);
+                UnsignedWide digits = static_cast<UnsignedWide>(rounded);
+
+                char reversed[48];
+                int count = 0;
+                do {
+                    reversed[count++] = static_cast<char>('0' + static_cast<int>(digits % 10));
+                    digits /= 10;
+                } while (digits != 0 || count <= precision);
+
+                bool negative = std::signbit(value.hi());
+                if (last - first < negative + count + (precision > 0)) {
+                    return {last, std::errc::value_too_large};
+                }
+                if (negative) {
+                    *first++ = '-';
+                }
+                while (count > 0) {
+                    if (count == precision) {
+                        *first++ = '.';
+                    }
+                    *first++ = reversed[--count];
+                }
+                return {first, std::errc()};
+            }
+#endif
+            return NumericTraits<double>::toChars(first, last, value.hi(), precision);
+        }
+    };
+}
+
+#endif // DOUBLE_DOUBLE_H
@@ -0,0 +1,104 @@
+/**
+ * @file double_double_batch.cpp
+ * @brief Implementation of DoubleDoubleBatch on top of the bulk kernels
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "double_double_batch.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace MathUtils::simd::detail;
+
+namespace {
+    void checkSizes(std::size_t a, std::size_t b) {
+        if (a != b) {
+            throw std::invalid_argument("Array sizes do not match");
+        }
+    }
+
+    void checkDivisor(const MathUtils::DoubleDouble& value) {
+        if (MathUtils::NumericTraits<MathUtils::DoubleDouble>::isNearZero(value)) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+    }
+}
+
+DoubleDoubleBatch::DoubleDoubleBatch(std::size_t size, MathUtils::DoubleDouble initial_value)
+    : hi_(size, initial_value.hi()), lo_(size, initial_value.lo()) {
+}
+
+DoubleDoubleBatch::DoubleDoubleBatch(std::span<const double> values)
+    : hi_(values.begin(), values.end()), lo_(values.size(), 0.0) {
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::setValue(MathUtils::DoubleDouble value) {
+    std::fill(hi_.begin(), hi_.end(), value.hi());
+    std::fill(lo_.begin(), lo_.end(), value.lo());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::add(MathUtils::DoubleDouble value) {
+    bulkKernels().doubleDoubleArrayScalar[Add](hi_.data(), lo_.data(), value.hi(), value.lo(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::add(const DoubleDoubleBatch& values) {
+    checkSizes(size(), values.size());
+    bulkKernels().doubleDoubleArrayArray[Add](hi_.data(), lo_.data(), values.hi_.data(), values.lo_.data(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::subtract(MathUtils::DoubleDouble value) {
+    bulkKernels().doubleDoubleArrayScalar[Subtract](hi_.data(), lo_.data(), value.hi(), value.lo(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::subtract(const DoubleDoubleBatch& values) {
+    checkSizes(size(), values.size());
+    bulkKernels().doubleDoubleArrayArray[Subtract](hi_.data(), lo_.data(), values.hi_.data(), values.lo_.data(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::multiply(MathUtils::DoubleDouble value) {
+    bulkKernels().doubleDoubleArrayScalar[Multiply](hi_.data(), lo_.data(), value.hi(), value.lo(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::multiply(const DoubleDoubleBatch& values) {
+    checkSizes(size(), values.size());
+    bulkKernels().doubleDoubleArrayArray[Multiply](hi_.data(), lo_.data(), values.hi_.data(), values.lo_.data(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::divide(MathUtils::DoubleDouble value) {
+    checkDivisor(value);
+    bulkKernels().doubleDoubleArrayScalar[Divide](hi_.data(), lo_.data(), value.hi(), value.lo(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::divide(const DoubleDoubleBatch& values) {
+    checkSizes(size(), values.size());
+    // The zero check only looks at the leading parts
+    if (std::any_of(values.hi_.begin(), values.hi_.end(), [](double hi) { return MathUtils::isNearZero(hi); })) {
+        throw std::invalid_argument("Division by zero is not allowed");
+    }
+    bulkKernels().doubleDoubleArrayArray[Divide](hi_.data(), lo_.data(), values.hi_.data(), values.lo_.data(), size());
+    return *this;
+}
+
+DoubleDoubleBatch& DoubleDoubleBatch::reset() {
+    return setValue(0.0);
+}
+
+std::vector<DoubleDoubleCalculator> DoubleDoubleBatch::toCalculators() const {
+    std::vector<DoubleDoubleCalculator> calculators;
+    calculators.reserve(size());
+    for (std::size_t i = 0; i < size(); ++i) {
+        calculators.emplace_back((*this)[i]);
+    }
+    return calculators;
+}
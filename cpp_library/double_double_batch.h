@@ -0,0 +1,196 @@
+/**
+ * @file double_double_batch.h
+ * @brief Many independent double-double accumulators stored as two columns
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * DoubleDoubleBatch is the double-double counterpart of CalculatorBatch.
+ * The leading and trailing parts of the lanes live in two SIMD-aligned
+ * arrays, so the branch-free DoubleDouble algorithms run on 4 (AVX2) or 8
+ * (AVX-512) lanes per instruction.
+ *
+ * @example
+ * ```cpp
+ * DoubleDoubleBatch balances(prices);        // one lane per price
+ * balances.multiply(MathUtils::DoubleDouble(1.0) / 3.0).add(fees);
+ * MathUtils::DoubleDouble first = balances[0];
+ * ```
+ */
+
+#ifndef DOUBLE_DOUBLE_BATCH_H
+#define DOUBLE_DOUBLE_BATCH_H
+
+#include "calculator_batch.h"
+#include "double_double.h"
+#include "double_double_calculator.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @class DoubleDoubleBatch
+ * @brief A fixed number of independent DoubleDouble values, one per lane
+ *
+ * Every operation applies to all lanes, taking either one DoubleDouble
+ * operand for every lane or another batch of the same size. Lane i gives
+ * bit for bit the result of the same DoubleDouble operators, whatever
+ * instruction set the kernels use, and divisions check for a zero divisor
+ * like DoubleDoubleCalculator.
+ */
+class DoubleDoubleBatch {
+public:
+    /// Alignment in bytes of the two part arrays
+    static constexpr std::size_t kAlignment = CalculatorBatch::kAlignment;
+
+private:
+    using Column = std::vector<double, MathUtils::detail::AlignedAllocator<double, kAlignment>>;
+
+    Column hi_; ///< Leading part of every lane
+    Column lo_; ///< Trailing part of every lane
+
+public:
+    /**
+     * @brief Creates an empty batch
+     */
+    DoubleDoubleBatch() = default;
+
+    /**
+     * @brief Creates a batch with every lane set to the same value
+     * @param size Number of lanes
+     * @param initial_value Starting value of every lane (default: 0.0)
+     */
+    explicit DoubleDoubleBatch(std::size_t size, MathUtils::DoubleDouble initial_value = 0.0);
+
+    /**
+     * @brief Creates a batch from one double starting value per lane
+     * @param values Starting values, copied in lane order
+     */
+    explicit DoubleDoubleBatch(std::span<const double> values);
+
+    /**
+     * @brief Gets the number of lanes
+     * @return Lane count
+     */
+    std::size_t size() const {
+        return hi_.size();
+    }
+
+    /**
+     * @brief Checks whether the batch has no lanes
+     * @return True if size() == 0
+     */
+    bool empty() const {
+        return hi_.empty();
+    }
+
+    /**
+     * @brief Gets the value of one lane
+     * @param index Lane index, must be below size()
+     * @return Current value of the lane
+     */
+    MathUtils::DoubleDouble operator[](std::size_t index) const {
+        return MathUtils::DoubleDouble(hi_[index], lo_[index]);
+    }
+
+    /**
+     * @brief Gets the leading parts, which are the lane values rounded to double
+     * @return Read-only view of the aligned array
+     */
+    std::span<const double> hi() const {
+        return hi_;
+    }
+
+    /**
+     * @brief Gets the trailing parts
+     * @return Read-only view of the aligned array
+     */
+    std::span<const double> lo() const {
+        return lo_;
+    }
+
+    /**
+     * @brief Sets every lane to the same value
+     * @param value New value
+     * @return Reference to this batch for chaining
+     */
+    DoubleDoubleBatch& setValue(MathUtils::DoubleDouble value);
+
+    /**
+     * @brief Adds a value to every lane
+     * @param value Value to add
+     * @return Reference to this batch for chaining
+     */
+    DoubleDoubleBatch& add(MathUtils::DoubleDouble value);
+
+    /**
+     * @brief Adds the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DoubleDoubleBatch& add(const DoubleDoubleBatch& values);
+
+    /**
+     * @brief Subtracts a value from every lane
+     * @param value Value to subtract
+     * @return Reference to this batch for chaining
+     */
+    DoubleDoubleBatch& subtract(MathUtils::DoubleDouble value);
+
+    /**
+     * @brief Subtracts the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DoubleDoubleBatch& subtract(const DoubleDoubleBatch& values);
+
+    /**
+     * @brief Multiplies every lane by a value
+     * @param value Value to multiply by
+     * @return Reference to this batch for chaining
+     */
+    DoubleDoubleBatch& multiply(MathUtils::DoubleDouble value);
+
+    /**
+     * @brief Multiplies each lane by the matching lane of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    DoubleDoubleBatch& multiply(const DoubleDoubleBatch& values);
+
+    /**
+     * @brief Divides every lane by a value
+     * @param value Value to divide by
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if value is zero
+     */
+    DoubleDoubleBatch& divide(MathUtils::DoubleDouble value);
+
+    /**
+     * @brief Divides each lane by the matching lane of another batch
+     * @param values Batch with one divisor per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if the sizes differ or any divisor is zero
+     *
+     * All divisors are validated first, so on an exception no lane has
+     * changed.
+     */
+    DoubleDoubleBatch& divide(const DoubleDoubleBatch& values);
+
+    /**
+     * @brief Resets every lane to zero
+     * @return Reference to this batch for chaining
+     */
+    DoubleDoubleBatch& reset();
+
+    /**
+     * @brief Copies the lanes out as individual calculators
+     * @return One DoubleDoubleCalculator per lane, in lane order
+     */
+    std::vector<DoubleDoubleCalculator> toCalculators() const;
+};
+
+#endif // DOUBLE_DOUBLE_BATCH_H
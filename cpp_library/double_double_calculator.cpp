@@ -0,0 +1,16 @@
+/**
+ * @file double_double_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on double-double numbers
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "double_double_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::DoubleDouble, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::DoubleDouble, MathUtils::IeeeDivision>;
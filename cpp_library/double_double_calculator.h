@@ -0,0 +1,34 @@
+/**
+ * @file double_double_calculator.h
+ * @brief BasicCalculator on the double-double numbers of double_double.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Kept out of calculator.h so that code using only Calculator does not
+ * parse the double-double arithmetic.
+ *
+ * @example
+ * ```cpp
+ * #include "double_double_calculator.h"
+ *
+ * DoubleDoubleCalculator calc(1.0);
+ * calc.divide(3.0).multiply(3.0); // 1 to about 32 digits
+ * ```
+ */
+
+#ifndef DOUBLE_DOUBLE_CALCULATOR_H
+#define DOUBLE_DOUBLE_CALCULATOR_H
+
+#include "calculator.h"
+#include "double_double.h"
+
+/**
+ * @brief Calculator with about 32 significant digits, see double_double.h
+ *
+ * Read the result with `getValue().value()` (rounded to double) or
+ * `getValue().hi()` and `getValue().lo()`.
+ */
+using DoubleDoubleCalculator = BasicCalculator<MathUtils::DoubleDouble, MathUtils::ThrowingDivision>;
+
+#endif // DOUBLE_DOUBLE_CALCULATOR_H
@@ -0,0 +1,342 @@
+/**
+ * @file integer.h
+ * @brief Fixed-width integers with a chosen overflow behaviour
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Built-in signed integer overflow is undefined behaviour. BasicInteger
+ * wraps a std::int64_t (or any signed integer) and gives every operation
+ * a defined outcome, selected at compile time by an OverflowMode:
+ * - Checked computes the wrapped result and sets a sticky overflowed()
+ *   flag, which flows into every result computed from it, so a chain of
+ *   counter updates is checked once at the end.
+ * - Saturating clamps to the smallest or largest value of the type.
+ * - Wrapping reduces modulo 2^bits, like unsigned arithmetic.
+ *
+ * Overflow is detected with __builtin_add_overflow and friends, which
+ * compile to the flags of the add/sub/imul instruction itself, so the
+ * result is selected without a branch in every mode.
+ *
+ * CheckedIntegerCalculator, SaturatingIntegerCalculator and
+ * WrappingIntegerCalculator (integer_calculator.h) run the fluent API on
+ * them, and IntegerBatch (integer_batch.h) applies it to whole columns.
+ * Divisor (divisor.h) divides them by a multiply and shift.
+ *
+ * @example
+ * ```cpp
+ * MathUtils::SaturatingInt64 hits = INT64_MAX - 1;
+ * hits = hits + 5;                    // INT64_MAX
+ * MathUtils::CheckedInt64 total = INT64_MAX;
+ * total = total * 2 - 1;              // wrapped, total.overflowed() == true
+ * ```
+ */
+
+#ifndef INTEGER_H
+#define INTEGER_H
+
+#include "divisor.h"
+#include "numeric_traits.h"
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace MathUtils {
+    /**
+     * @brief What an integer operation does when its result does not fit
+     */
+    enum class OverflowMode {
+        Checked,    ///< Wraps and sets a sticky overflow flag
+        Saturating, ///< Clamps to the range of the type
+        Wrapping    ///< Wraps modulo 2^bits
+    };
+
+    /// @cond INTERNAL
+    namespace detail {
+        /// Overflow flag of a checked integer; takes no space in the other modes
+        template <bool Tracked>
+        struct OverflowFlag {
+            constexpr bool get() const {
+                return false;
+            }
+
+            constexpr void set(bool) {
+            }
+        };
+
+        template <>
+        struct OverflowFlag<true> {
+            bool value = false;
+
+            constexpr bool get() const {
+                return value;
+            }
+
+            constexpr void set(bool overflowed) {
+                value = overflowed;
+            }
+        };
+    }
+    /// @endcond
+
+    /**
+     * @class BasicInteger
+     * @brief A signed integer whose overflow behaviour is part of its type
+     * @tparam Rep Signed integer type holding the value
+     * @tparam Mode Checked, Saturating or Wrapping
+     *
+     * Converts implicitly from Rep, which lets it stand in for the value
+     * type of BasicCalculator. Division truncates toward zero like the
+     * built-in operator and throws on a zero divisor; its one overflowing
+     * case, min / -1, follows Mode. Comparisons compare values only, not
+     * the overflow flag.
+     */
+    template <typename Rep, OverflowMode Mode>
+    class BasicInteger {
+        static_assert(std::is_integral_v<Rep> && std::is_signed_v<Rep>, "Rep must be a signed integer type");
+
+    private:
+        static constexpr Rep kMin = std::numeric_limits<Rep>::min();
+        static constexpr Rep kMax = std::numeric_limits<Rep>::max();
+
+        Rep value_ = 0; ///< Value, wrapped if it overflowed in Checked mode
+        [[no_unique_address]] detail::OverflowFlag<Mode == OverflowMode::Checked> overflowed_;
+
+        // `wrapped` is the exact result modulo 2^bits; when `overflow` is
+        // set, the exact result lies above kMax if `upward`, below kMin if not
+        static constexpr BasicInteger finish(Rep wrapped, bool overflow, bool upward, bool inherited) {
+            BasicInteger result;
+            if constexpr (Mode == OverflowMode::Saturating) {
+                result.value_ = overflow ? (upward ? kMax : kMin) : wrapped;
+            } else {
+                result.value_ = wrapped;
+            }
+            result.overflowed_.set(overflow || inherited);
+            return result;
+        }
+
+        static constexpr bool inherited(BasicInteger a, BasicInteger b) {
+            return a.overflowed_.get() || b.overflowed_.get();
+        }
+
+    public:
+        /// Overflow behaviour of the type
+        static constexpr OverflowMode mode = Mode;
+
+        /**
+         * @brief Creates zero
+         */
+        constexpr BasicInteger() = default;
+
+        /**
+         * @brief Creates an integer
+         * @param value Initial value
+         */
+        constexpr BasicInteger(Rep value) : value_(value) {
+        }
+
+        /**
+         * @brief Creates a checked integer with a given overflow flag
+         * @param value Initial value
+         * @param overflowed Initial state of the flag, e.g. when restoring a
+         *        value read out of an IntegerBatch
+         */
+        constexpr BasicInteger(Rep value, bool overflowed)
+            requires(Mode == OverflowMode::Checked)
+            : value_(value) {
+            overflowed_.set(overflowed);
+        }
+
+        /**
+         * @brief Gets the value
+         * @return Value; after a checked overflow, the wrapped result
+         */
+        constexpr Rep value() const {
+            return value_;
+        }
+
+        /**
+         * @brief Checks whether this value or any it was computed from
+         *        overflowed
+         * @return True once an operation did not fit
+         */
+        constexpr bool overflowed() const
+            requires(Mode == OverflowMode::Checked)
+        {
+            return overflowed_.get();
+        }
+
+        constexpr BasicInteger operator-() const {
+            return BasicInteger(0) - *this;
+        }
+
+        friend constexpr BasicInteger operator+(BasicInteger a, BasicInteger b) {
+            Rep sum = 0;
+            const bool overflow = __builtin_add_overflow(a.value_, b.value_, &sum);
+            return finish(sum, overflow, a.value_ >= 0, inherited(a, b));
+        }
+
+        friend constexpr BasicInteger operator-(BasicInteger a, BasicInteger b) {
+            Rep difference = 0;
+            const bool overflow = __builtin_sub_overflow(a.value_, b.value_, &difference);
+            return finish(difference, overflow, a.value_ >= 0, inherited(a, b));
+        }
+
+        friend constexpr BasicInteger operator*(BasicInteger a, BasicInteger b) {
+            Rep product = 0;
+            const bool overflow = __builtin_mul_overflow(a.value_, b.value_, &product);
+            return finish(product, overflow, (a.value_ < 0) == (b.value_ < 0), inherited(a, b));
+        }
+
+        /// Quotient truncated toward zero
+        /// @throws std::invalid_argument if b is zero
+        friend constexpr BasicInteger operator/(BasicInteger a, BasicInteger b) {
+            if (b.value_ == 0) {
+                throw std::invalid_argument("Division by zero is not allowed");
+            }
+            const bool overflow = a.value_ == kMin && b.value_ == -1;
+            return finish(overflow ? kMin : Rep(a.value_ / b.value_), overflow, true, inherited(a, b));
+        }
+
+        constexpr BasicInteger& operator+=(BasicInteger other) {
+            return *this = *this + other;
+        }
+
+        constexpr BasicInteger& operator-=(BasicInteger other) {
+            return *this = *this - other;
+        }
+
+        constexpr BasicInteger& operator*=(BasicInteger other) {
+            return *this = *this * other;
+        }
+
+        constexpr BasicInteger& operator/=(BasicInteger other) {
+            return *this = *this / other;
+        }
+
+        friend constexpr bool operator==(BasicInteger a, BasicInteger b) {
+            return a.value_ == b.value_;
+        }
+
+        friend constexpr std::strong_ordering operator<=>(BasicInteger a, BasicInteger b) {
+            return a.value_ <=> b.value_;
+        }
+    };
+
+    /**
+     * @brief 64-bit integer that flags overflow
+     */
+    using CheckedInt64 = BasicInteger<std::int64_t, OverflowMode::Checked>;
+
+    /**
+     * @brief 64-bit integer that clamps on overflow
+     */
+    using SaturatingInt64 = BasicInteger<std::int64_t, OverflowMode::Saturating>;
+
+    /**
+     * @brief 64-bit integer that wraps on overflow
+     */
+    using WrappingInt64 = BasicInteger<std::int64_t, OverflowMode::Wrapping>;
+
+    /**
+     * @brief 32-bit integer that flags overflow
+     */
+    using CheckedInt32 = BasicInteger<std::int32_t, OverflowMode::Checked>;
+
+    /**
+     * @brief 32-bit integer that clamps on overflow
+     */
+    using SaturatingInt32 = BasicInteger<std::int32_t, OverflowMode::Saturating>;
+
+    /**
+     * @brief 32-bit integer that wraps on overflow
+     */
+    using WrappingInt32 = BasicInteger<std::int32_t, OverflowMode::Wrapping>;
+
+    /**
+     * @brief Numeric rules for overflow-aware integers: exact, printed like
+     *        the underlying integer, or as "overflow" once a checked value
+     *        has overflowed
+     */
+    template <typename Rep, OverflowMode Mode>
+    struct NumericTraits<BasicInteger<Rep, Mode>> {
+        using Integer = BasicInteger<Rep, Mode>;
+
+        static constexpr bool isNearZero(const Integer& b) {
+            return b.value() == 0;
+        }
+
+        static constexpr bool approximatelyEqual(const Integer& a, const Integer& b) {
+            return a == b;
+        }
+
+        static std::to_chars_result toChars(char* first, char* last, const Integer& value, int precision) {
+            if constexpr (Mode == OverflowMode::Checked) {
+                if (value.overflowed()) {
+                    constexpr char kText[] = "overflow";
+                    if (last - first < static_cast<std::ptrdiff_t>(sizeof(kText) - 1)) {
+                        return {last, std::errc::value_too_large};
+                    }
+                    std::memcpy(first, kText, sizeof(kText) - 1);
+                    return {first + sizeof(kText) - 1, std::errc()};
+                }
+            }
+            return NumericTraits<Rep>::toChars(first, last, value.value(), precision);
+        }
+    };
+
+    /**
+     * @brief Divisor of an overflow-aware integer
+     *
+     * Uses the magic multiplier of its Rep and gives the same quotient,
+     * overflow flag included, as BasicInteger's operator/.
+     */
+    template <typename Rep, OverflowMode Mode>
+    class Divisor<BasicInteger<Rep, Mode>> {
+        using Integer = BasicInteger<Rep, Mode>;
+
+    public:
+        /**
+         * @brief Validates a divisor and computes its magic multiplier
+         * @param divisor Value to divide by
+         * @throws std::invalid_argument if divisor is zero
+         */
+        explicit constexpr Divisor(Integer divisor) : divisor_(divisor), magic_(divisor.value()) {
+        }
+
+        /**
+         * @brief Gets the divisor
+         * @return Value divided by
+         */
+        constexpr Integer value() const {
+            return divisor_;
+        }
+
+        /**
+         * @brief Divides a value by the divisor
+         * @param dividend Value to divide
+         * @return dividend / value()
+         */
+        constexpr Integer divide(Integer dividend) const {
+            if (divisor_.value() == -1) {
+                return dividend / divisor_; // min / -1 overflows as Mode says
+            }
+            if constexpr (Mode == OverflowMode::Checked) {
+                return Integer(magic_.divide(dividend.value()), dividend.overflowed() || divisor_.overflowed());
+            } else {
+                return Integer(magic_.divide(dividend.value()));
+            }
+        }
+
+    private:
+        Integer divisor_;    ///< Validated divisor
+        Divisor<Rep> magic_; ///< Division of the underlying integer
+    };
+}
+
+#endif // INTEGER_H
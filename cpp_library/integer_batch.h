@@ -0,0 +1,367 @@
+/**
+ * @file integer_batch.h
+ * @brief A column of 64-bit counters with a chosen overflow behaviour
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * IntegerBatch is the BasicInteger counterpart of CalculatorBatch. The
+ * lanes live in one SIMD-aligned std::int64_t array and addition and
+ * subtraction run 4 (AVX2) or 8 (AVX-512) lanes per instruction in every
+ * OverflowMode, and 2 with SSE2 except when saturating:
+ * - Wrapping is the plain vector add or subtract.
+ * - Saturating and Checked detect overflow from the sign bits,
+ *   ((a ^ r) & (b ^ r)) < 0 for r = a + b, and then blend in the clamped
+ *   value or record the lane in a mask. x86 only has native saturating
+ *   adds for 8- and 16-bit lanes, so 64-bit lanes take this route.
+ *
+ * Multiplication and division run lane by lane through the BasicInteger
+ * operators, since there is no 64-bit vector multiply with overflow
+ * detection. To divide by the same value many times, pass a
+ * MathUtils::Divisor, which replaces the hardware divide with a multiply.
+ *
+ * @example
+ * ```cpp
+ * IntegerBatch<MathUtils::OverflowMode::Checked> counters(hits);
+ * counters.add(increments).multiply(weight);
+ * if (counters.overflowed().any()) {
+ *     counters.overflowed().forEachSet([](std::size_t lane) { ... });
+ * }
+ * ```
+ */
+
+#ifndef INTEGER_BATCH_H
+#define INTEGER_BATCH_H
+
+#include "calculator_batch.h"
+#include "divisor.h"
+#include "integer.h"
+#include "integer_calculator.h"
+#include "lane_mask.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class IntegerBatch
+ * @brief A fixed number of independent 64-bit integers, one per lane
+ * @tparam Mode Overflow behaviour of every lane
+ *
+ * Every operation applies to all lanes, taking either one operand for
+ * every lane or another batch of the same size. Lane i holds exactly what
+ * the BasicInteger operators give, including, in Checked mode, its sticky
+ * overflow flag, which is kept as one bit per lane in overflowed().
+ */
+template <MathUtils::OverflowMode Mode>
+class IntegerBatch {
+public:
+    /// Value of one lane
+    using Value = MathUtils::BasicInteger<std::int64_t, Mode>;
+
+    /// Alignment in bytes of the value array
+    static constexpr std::size_t kAlignment = CalculatorBatch::kAlignment;
+
+private:
+    static constexpr bool kChecked = Mode == MathUtils::OverflowMode::Checked;
+
+    using Column = std::vector<std::int64_t, MathUtils::detail::AlignedAllocator<std::int64_t, kAlignment>>;
+
+    Column values_;                  ///< Value of every lane
+    MathUtils::LaneMask overflowed_; ///< Overflow flag of every lane, Checked mode only
+
+    static void checkSizes(std::size_t a, std::size_t b) {
+        if (a != b) {
+            throw std::invalid_argument("Array sizes do not match");
+        }
+    }
+
+    void store(std::size_t index, Value value) {
+        values_[index] = value.value();
+        if constexpr (kChecked) {
+            overflowed_.set(index, value.overflowed());
+        }
+    }
+
+    template <MathUtils::simd::detail::Op op>
+    IntegerBatch& apply(Value value) {
+        const auto& kernels = MathUtils::simd::detail::bulkKernels();
+        if constexpr (Mode == MathUtils::OverflowMode::Wrapping) {
+            kernels.int64ArrayScalar[op](values_.data(), value.value(), size());
+        } else if constexpr (Mode == MathUtils::OverflowMode::Saturating) {
+            kernels.int64SaturatingArrayScalar[op](values_.data(), value.value(), size());
+        } else {
+            kernels.int64CheckedArrayScalar[op](values_.data(), value.value(), overflowed_.words().data(), size());
+            if (value.overflowed()) {
+                overflowed_.assign(size(), true);
+            }
+        }
+        return *this;
+    }
+
+    template <MathUtils::simd::detail::Op op>
+    IntegerBatch& apply(const IntegerBatch& values) {
+        checkSizes(size(), values.size());
+        const auto& kernels = MathUtils::simd::detail::bulkKernels();
+        if constexpr (Mode == MathUtils::OverflowMode::Wrapping) {
+            kernels.int64ArrayArray[op](values_.data(), values.values_.data(), size());
+        } else if constexpr (Mode == MathUtils::OverflowMode::Saturating) {
+            kernels.int64SaturatingArrayArray[op](values_.data(), values.values_.data(), size());
+        } else {
+            kernels.int64CheckedArrayArray[op](values_.data(), values.values_.data(), overflowed_.words().data(),
+                                               size());
+            overflowed_ |= values.overflowed_;
+        }
+        return *this;
+    }
+
+public:
+    /**
+     * @brief Creates an empty batch
+     */
+    IntegerBatch() = default;
+
+    /**
+     * @brief Creates a batch with every lane set to the same value
+     * @param size Number of lanes
+     * @param initial_value Starting value of every lane (default: 0)
+     */
+    explicit IntegerBatch(std::size_t size, Value initial_value = 0) : values_(size) {
+        setValue(initial_value);
+    }
+
+    /**
+     * @brief Creates a batch from one starting value per lane
+     * @param values Starting values, copied in lane order
+     */
+    explicit IntegerBatch(std::span<const std::int64_t> values) : values_(values.begin(), values.end()) {
+        if constexpr (kChecked) {
+            overflowed_.assign(size(), false);
+        }
+    }
+
+    /**
+     * @brief Creates a batch from one starting value per lane, keeping
+     *        overflow flags in Checked mode
+     * @param values Starting values, copied in lane order
+     */
+    explicit IntegerBatch(std::span<const Value> values) : values_(values.size()) {
+        if constexpr (kChecked) {
+            overflowed_.assign(size(), false);
+        }
+        for (std::size_t i = 0; i < size(); ++i) {
+            store(i, values[i]);
+        }
+    }
+
+    /**
+     * @brief Gets the number of lanes
+     * @return Lane count
+     */
+    std::size_t size() const {
+        return values_.size();
+    }
+
+    /**
+     * @brief Checks whether the batch has no lanes
+     * @return True if size() == 0
+     */
+    bool empty() const {
+        return values_.empty();
+    }
+
+    /**
+     * @brief Gets the value of one lane
+     * @param index Lane index, must be below size()
+     * @return Current value of the lane, with its overflow flag in Checked mode
+     */
+    Value operator[](std::size_t index) const {
+        if constexpr (kChecked) {
+            return Value(values_[index], overflowed_.test(index));
+        } else {
+            return Value(values_[index]);
+        }
+    }
+
+    /**
+     * @brief Gets the values of all lanes
+     * @return Read-only view of the aligned array; lanes that overflowed in
+     *         Checked mode hold the wrapped result
+     */
+    std::span<const std::int64_t> values() const {
+        return values_;
+    }
+
+    /**
+     * @brief Gets the lanes that have overflowed
+     * @return Mask with bit i set once lane i overflowed, until setValue()
+     *         or reset()
+     */
+    const MathUtils::LaneMask& overflowed() const
+        requires(kChecked)
+    {
+        return overflowed_;
+    }
+
+    /**
+     * @brief Sets every lane to the same value
+     * @param value New value, whose overflow flag every lane takes over
+     * @return Reference to this batch for chaining
+     */
+    IntegerBatch& setValue(Value value) {
+        std::fill(values_.begin(), values_.end(), value.value());
+        if constexpr (kChecked) {
+            overflowed_.assign(size(), value.overflowed());
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Adds a value to every lane
+     * @param value Value to add
+     * @return Reference to this batch for chaining
+     */
+    IntegerBatch& add(Value value) {
+        return apply<MathUtils::simd::detail::Add>(value);
+    }
+
+    /**
+     * @brief Adds the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    IntegerBatch& add(const IntegerBatch& values) {
+        return apply<MathUtils::simd::detail::Add>(values);
+    }
+
+    /**
+     * @brief Subtracts a value from every lane
+     * @param value Value to subtract
+     * @return Reference to this batch for chaining
+     */
+    IntegerBatch& subtract(Value value) {
+        return apply<MathUtils::simd::detail::Subtract>(value);
+    }
+
+    /**
+     * @brief Subtracts the lanes of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    IntegerBatch& subtract(const IntegerBatch& values) {
+        return apply<MathUtils::simd::detail::Subtract>(values);
+    }
+
+    /**
+     * @brief Multiplies every lane by a value
+     * @param value Value to multiply by
+     * @return Reference to this batch for chaining
+     */
+    IntegerBatch& multiply(Value value) {
+        for (std::size_t i = 0; i < size(); ++i) {
+            store(i, (*this)[i] * value);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies each lane by the matching lane of another batch
+     * @param values Batch with one value per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if values.size() != size()
+     */
+    IntegerBatch& multiply(const IntegerBatch& values) {
+        checkSizes(size(), values.size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            store(i, (*this)[i] * values[i]);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Divides every lane by a value, truncating toward zero
+     * @param value Value to divide by
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if value is zero
+     */
+    IntegerBatch& divide(Value value) {
+        if (value.value() == 0) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        for (std::size_t i = 0; i < size(); ++i) {
+            store(i, (*this)[i] / value);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Divides every lane by a prepared divisor
+     * @param divisor Divisor, validated when it was built
+     * @return Reference to this batch for chaining
+     *
+     * Gives the same lanes as divide(divisor.value()), with a multiply and
+     * shift per lane instead of a hardware divide.
+     */
+    IntegerBatch& divide(const MathUtils::Divisor<Value>& divisor) {
+        if (divisor.value() == -1) {
+            return divide(divisor.value()); // the one divisor that can overflow
+        }
+        for (std::int64_t& lane : values_) {
+            lane = divisor.divide(Value(lane)).value();
+        }
+        if constexpr (kChecked) {
+            if (divisor.value().overflowed()) {
+                overflowed_.assign(size(), true);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Divides each lane by the matching lane of another batch
+     * @param values Batch with one divisor per lane
+     * @return Reference to this batch for chaining
+     * @throws std::invalid_argument if the sizes differ or any divisor is zero
+     *
+     * All divisors are validated first, so on an exception no lane has
+     * changed.
+     */
+    IntegerBatch& divide(const IntegerBatch& values) {
+        checkSizes(size(), values.size());
+        if (std::find(values.values_.begin(), values.values_.end(), 0) != values.values_.end()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        for (std::size_t i = 0; i < size(); ++i) {
+            store(i, (*this)[i] / values[i]);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Resets every lane to zero and clears the overflow flags
+     * @return Reference to this batch for chaining
+     */
+    IntegerBatch& reset() {
+        return setValue(0);
+    }
+
+    /**
+     * @brief Copies the lanes out as individual calculators
+     * @return One calculator per lane, in lane order
+     */
+    std::vector<BasicCalculator<Value, MathUtils::ThrowingDivision>> toCalculators() const {
+        std::vector<BasicCalculator<Value, MathUtils::ThrowingDivision>> calculators;
+        calculators.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            calculators.emplace_back((*this)[i]);
+        }
+        return calculators;
+    }
+};
+
+#endif // INTEGER_BATCH_H
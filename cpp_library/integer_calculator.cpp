@@ -0,0 +1,17 @@
+/**
+ * @file integer_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on overflow-aware integers
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "integer_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::CheckedInt64, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::SaturatingInt64, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::WrappingInt64, MathUtils::ThrowingDivision>;
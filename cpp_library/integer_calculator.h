@@ -0,0 +1,54 @@
+/**
+ * @file integer_calculator.h
+ * @brief BasicCalculator on the overflow-aware integers of integer.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Kept out of calculator.h because integer.h detects overflow with
+ * __builtin_add_overflow and friends (GCC, Clang), and so that code using
+ * only Calculator does not parse the integer types.
+ *
+ * @example
+ * ```cpp
+ * #include "integer_calculator.h"
+ *
+ * SaturatingIntegerCalculator hits(INT64_MAX - 1);
+ * hits.add(5); // INT64_MAX
+ * ```
+ */
+
+#ifndef INTEGER_CALCULATOR_H
+#define INTEGER_CALCULATOR_H
+
+#include "calculator.h"
+#include "integer.h"
+
+/**
+ * @brief Calculator on std::int64_t that flags overflow, see integer.h
+ *
+ * An overflowing operation wraps and marks the value; hasError() and
+ * result() then report MathUtils::MathError::Overflow until clearError().
+ *
+ * @example
+ * ```cpp
+ * CheckedIntegerCalculator counter(INT64_MAX);
+ * counter.add(1).subtract(1);
+ * if (!counter.result()) {
+ *     // counter.result().error() == MathUtils::MathError::Overflow
+ * }
+ * ```
+ */
+using CheckedIntegerCalculator = BasicCalculator<MathUtils::CheckedInt64, MathUtils::ThrowingDivision>;
+
+/**
+ * @brief Calculator on std::int64_t that clamps to INT64_MIN and INT64_MAX
+ */
+using SaturatingIntegerCalculator = BasicCalculator<MathUtils::SaturatingInt64, MathUtils::ThrowingDivision>;
+
+/**
+ * @brief Calculator on std::int64_t that wraps modulo 2^64
+ */
+using WrappingIntegerCalculator = BasicCalculator<MathUtils::WrappingInt64, MathUtils::ThrowingDivision>;
+
+#endif // INTEGER_CALCULATOR_H
@@ -0,0 +1,205 @@
+/**
+ * @file lane_mask.h
+ * @brief Compact one-bit-per-element mask for bulk and batch operations
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A LaneMask records a yes/no flag for every element of an array, packed
+ * 64 to a word, so a 10M-element column needs about 1.2 MB of flags. The
+ * non-throwing bulk divide reports its failed lanes in one.
+ *
+ * @example
+ * ```cpp
+ * MathUtils::LaneMask errors;
+ * MathUtils::tryDivide(a, b, out, errors);
+ * errors.forEachSet([&](std::size_t i) {
+ *     std::cerr << "lane " << i << " divided by zero\n";
+ * });
+ * ```
+ */
+
+#ifndef LANE_MASK_H
+#define LANE_MASK_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace MathUtils {
+    /**
+     * @class LaneMask
+     * @brief A fixed-size sequence of bits, one per array element
+     *
+     * Bit i of the mask lives in bit (i % 64) of words()[i / 64]. Bits past
+     * size() in the last word are always zero.
+     */
+    class LaneMask {
+    private:
+        std::vector<std::uint64_t> words_; ///< Packed bits, 64 lanes per word
+        std::size_t size_ = 0;             ///< Number of lanes
+
+    public:
+        /// Number of lanes stored in one word
+        static constexpr std::size_t kLanesPerWord = 64;
+
+        /**
+         * @brief Creates an empty mask
+         */
+        LaneMask() = default;
+
+        /**
+         * @brief Creates a mask with every bit set to the same value
+         * @param size Number of lanes
+         * @param value Initial value of every bit (default: false)
+         */
+        explicit LaneMask(std::size_t size, bool value = false) {
+            assign(size, value);
+        }
+
+        /**
+         * @brief Resizes the mask and sets every bit to the same value
+         * @param size Number of lanes
+         * @param value New value of every bit
+         */
+        void assign(std::size_t size, bool value) {
+            size_ = size;
+            words_.assign((size + kLanesPerWord - 1) / kLanesPerWord, value ? ~std::uint64_t(0) : 0);
+            if (value && size % kLanesPerWord != 0) {
+                words_.back() = (std::uint64_t(1) << (size % kLanesPerWord)) - 1;
+            }
+        }
+
+        /**
+         * @brief Gets the number of lanes
+         * @return Lane count
+         */
+        std::size_t size() const {
+            return size_;
+        }
+
+        /**
+         * @brief Reads one bit
+         * @param index Lane index, must be below size()
+         * @return Value of the bit
+         */
+        bool test(std::size_t index) const {
+            return (words_[index / kLanesPerWord] >> (index % kLanesPerWord)) & 1;
+        }
+
+        /**
+         * @brief Writes one bit
+         * @param index Lane index, must be below size()
+         * @param value New value of the bit (default: true)
+         */
+        void set(std::size_t index, bool value = true) {
+            std::uint64_t bit = std::uint64_t(1) << (index % kLanesPerWord);
+            if (value) {
+                words_[index / kLanesPerWord] |= bit;
+            } else {
+                words_[index / kLanesPerWord] &= ~bit;
+            }
+        }
+
+        /**
+         * @brief Checks whether any bit is set
+         * @return True if at least one lane is flagged
+         */
+        bool any() const {
+            for (std::uint64_t word : words_) {
+                if (word != 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Counts the set bits
+         * @return Number of flagged lanes
+         */
+        std::size_t count() const {
+            std::size_t total = 0;
+            for (std::uint64_t word : words_) {
+                total += std::popcount(word);
+            }
+            return total;
+        }
+
+        /**
+         * @brief Inverts every bit
+         * @return Reference to this mask
+         */
+        LaneMask& flip() {
+            for (std::uint64_t& word : words_) {
+                word = ~word;
+            }
+            if (size_ % kLanesPerWord != 0) {
+                words_.back() &= (std::uint64_t(1) << (size_ % kLanesPerWord)) - 1;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Keeps only the bits also set in another mask of the same size
+         * @param other Mask to intersect with
+         * @return Reference to this mask
+         */
+        LaneMask& operator&=(const LaneMask& other) {
+            for (std::size_t w = 0; w < words_.size(); ++w) {
+                words_[w] &= other.words_[w];
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Sets the bits set in another mask of the same size
+         * @param other Mask to merge in
+         * @return Reference to this mask
+         */
+        LaneMask& operator|=(const LaneMask& other) {
+            for (std::size_t w = 0; w < words_.size(); ++w) {
+                words_[w] |= other.words_[w];
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Calls a function with the index of every set bit, in order
+         * @param fn Callable taking a std::size_t lane index
+         *
+         * Skips 64 clear lanes at a time, so visiting a sparse mask costs
+         * little more than reading it.
+         */
+        template <typename Fn>
+        void forEachSet(Fn fn) const {
+            for (std::size_t w = 0; w < words_.size(); ++w) {
+                for (std::uint64_t word = words_[w]; word != 0; word &= word - 1) {
+                    fn(w * kLanesPerWord + std::countr_zero(word));
+                }
+            }
+        }
+
+        /**
+         * @brief Gets the packed words
+         * @return Read-only view of ceil(size() / 64) words
+         */
+        std::span<const std::uint64_t> words() const {
+            return words_;
+        }
+
+        /**
+         * @brief Gets the packed words for direct modification
+         * @return Mutable view of ceil(size() / 64) words
+         *
+         * Callers must keep the bits past size() clear.
+         */
+        std::span<std::uint64_t> words() {
+            return words_;
+        }
+    };
+}
+
+#endif // LANE_MASK_H
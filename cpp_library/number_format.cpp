@@ -0,0 +1,71 @@
+/**
+ * @file number_format.cpp
+ * @brief Implementation of the bulk value formatter
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "number_format.h"
+#include "calculator.h"
+#include "parallel.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <vector>
+
+namespace {
+    // Below this many values per thread, spawning costs more than it saves
+    const std::size_t kMinValuesPerWorker = 1 << 14;
+
+    // Typical rendered width, used to size chunk buffers up front
+    const std::size_t kTypicalWidth = 16;
+
+    void appendValue(std::string& text, double value, int precision) {
+        char buffer[128];
+        auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, precision);
+        if (ec == std::errc()) {
+            text.append(buffer, end);
+        } else {
+            text += Calculator(value).toString(precision);
+        }
+    }
+
+    void formatChunk(std::span<const double> values, std::string& text, const FormatOptions& options) {
+        text.reserve(text.size() + values.size() * (kTypicalWidth + static_cast<std::size_t>(std::max(options.precision, 0))));
+        for (double value : values) {
+            appendValue(text, value, options.precision);
+            text += options.delimiter == Delimiter::Comma ? ',' : '\n';
+        }
+    }
+}
+
+void formatValues(std::span<const double> values, std::string& out, const FormatOptions& options) {
+    if (values.empty()) {
+        return;
+    }
+    const unsigned workers = parallel::workerCount(options.threads, values.size(), kMinValuesPerWorker);
+    if (workers == 1) {
+        formatChunk(values, out, options);
+    } else {
+        std::vector<std::string> chunks(workers);
+        parallel::run(workers, [&](unsigned w) {
+            std::size_t begin = parallel::sliceBegin(values.size(), workers, w);
+            std::size_t end = parallel::sliceBegin(values.size(), workers, w + 1);
+            formatChunk(values.subspan(begin, end - begin), chunks[w], options);
+        });
+
+        std::vector<std::size_t> offsets(workers + 1, out.size());
+        for (unsigned w = 0; w < workers; ++w) {
+            offsets[w + 1] = offsets[w] + chunks[w].size();
+        }
+        out.resize(offsets[workers]);
+        parallel::run(workers, [&](unsigned w) {
+            std::memcpy(out.data() + offsets[w], chunks[w].data(), chunks[w].size());
+            std::string().swap(chunks[w]);
+        });
+    }
+    if (options.delimiter == Delimiter::Comma) {
+        out.pop_back();
+    }
+}
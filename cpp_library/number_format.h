@@ -0,0 +1,58 @@
+/**
+ * @file number_format.h
+ * @brief Bulk fixed-point formatting of values into one text buffer
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Exporting millions of results through Calculator::toString() builds one
+ * std::string per value. formatValues() instead writes a whole column as a
+ * single delimited text block, with each value formatted exactly as
+ * toString() would format it, and splits the work across threads.
+ *
+ * @example
+ * ```cpp
+ * std::vector<double> values = {1.5, 2.25, -3.0};
+ * std::string text;
+ * formatValues(values, text, {.precision = 2, .delimiter = Delimiter::Comma});
+ * // text == "1.50,2.25,-3.00"
+ * ```
+ */
+
+#ifndef NUMBER_FORMAT_H
+#define NUMBER_FORMAT_H
+
+#include <span>
+#include <string>
+
+/**
+ * @brief How formatValues() separates consecutive values
+ */
+enum class Delimiter {
+    Comma,  ///< CSV row: values separated by ',', no trailing delimiter
+    Newline ///< One value per line, every line terminated by '\n'
+};
+
+/**
+ * @brief Options for formatValues()
+ */
+struct FormatOptions {
+    int precision = 2;                        ///< Decimal places, as in Calculator::toString()
+    Delimiter delimiter = Delimiter::Newline; ///< Separator between values
+    unsigned threads = 0;                     ///< Worker count, or 0 for the hardware concurrency
+};
+
+/**
+ * @brief Appends a column of values to a text buffer
+ * @param values Values to format, in output order
+ * @param out Buffer the text is appended to; existing contents are kept
+ * @param options Precision, delimiter and thread count
+ *
+ * Every value is rendered as Calculator(value).toString(precision) would
+ * render it. Each thread formats a contiguous chunk into a private buffer,
+ * and the chunks are then copied into @p out in order with a single
+ * resize, so the output does not depend on the thread count.
+ */
+void formatValues(std::span<const double> values, std::string& out, const FormatOptions& options = {});
+
+#endif // NUMBER_FORMAT_H
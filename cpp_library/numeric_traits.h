@@ -0,0 +1,141 @@
+/**
+ * @file numeric_traits.h
+ * @brief Per-type rules used by BasicCalculator and the templated MathUtils
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * NumericTraits<T> tells the library what "zero divisor" and "equal" mean
+ * for a value type, and how to print it. Floating-point types use the
+ * historical 1e-10 zero threshold and an absolute equality tolerance;
+ * every other type is treated as exact. A custom value type plugs in by
+ * specializing NumericTraits.
+ *
+ * @example
+ * ```cpp
+ * static_assert(MathUtils::NumericTraits<double>::isNearZero(1e-12));
+ * static_assert(!MathUtils::NumericTraits<int>::isNearZero(1));
+ * ```
+ */
+
+#ifndef NUMERIC_TRAITS_H
+#define NUMERIC_TRAITS_H
+
+#include <charconv>
+#include <concepts>
+#include <type_traits>
+
+namespace MathUtils {
+    /**
+     * @brief Divisors with a smaller magnitude are treated as zero
+     */
+    inline constexpr double kZeroThreshold = 1e-10;
+
+    /**
+     * @brief Checks a divisor against kZeroThreshold
+     * @param b Divisor
+     * @return True if |b| < kZeroThreshold (false for NaN)
+     *
+     * Usable in constant expressions, unlike std::abs before C++23.
+     */
+    constexpr bool isNearZero(double b) {
+        return b < kZeroThreshold && b > -kZeroThreshold;
+    }
+
+    /**
+     * @brief Numeric rules for an exact value type (integers, custom types)
+     * @tparam T Value type
+     *
+     * Only an exact zero is a zero divisor and equality is exact. Integral
+     * types print as their digits followed by `precision` zero decimals.
+     * Specialize this template to give a custom type other rules or to
+     * make it printable.
+     */
+    template <typename T>
+    struct NumericTraits {
+        /**
+         * @brief Checks whether a divisor is treated as zero
+         * @param b Divisor
+         * @return True if b == 0
+         */
+        static constexpr bool isNearZero(const T& b) {
+            return b == T(0);
+        }
+
+        /**
+         * @brief Equality used by BasicCalculator::operator==
+         * @return True if a == b
+         */
+        static constexpr bool approximatelyEqual(const T& a, const T& b) {
+            return a == b;
+        }
+
+        /**
+         * @brief Writes a value as fixed-point text
+         * @param first Start of the destination buffer
+         * @param last One past the end of the destination buffer
+         * @param value Value to print
+         * @param precision Number of decimal places
+         * @return Same contract as std::to_chars
+         */
+        static std::to_chars_result toChars(char* first, char* last, const T& value, int precision) {
+            static_assert(std::is_integral_v<T>, "specialize MathUtils::NumericTraits<T>::toChars for this type");
+            std::to_chars_result result = std::to_chars(first, last, value);
+            if (result.ec != std::errc() || precision <= 0) {
+                return result;
+            }
+            if (last - result.ptr < 1 + precision) {
+                return {last, std::errc::value_too_large};
+            }
+            *result.ptr++ = '.';
+            for (int i = 0; i < precision; ++i) {
+                *result.ptr++ = '0';
+            }
+            return result;
+        }
+    };
+
+    /**
+     * @brief Numeric rules for float, double and long double
+     * @tparam T Floating-point type
+     *
+     * Divisors with |b| < 1e-10 are zero. Values compare equal within an
+     * absolute tolerance of 1e-9 (1e-5 for float, which only carries about
+     * seven significant digits).
+     */
+    template <std::floating_point T>
+    struct NumericTraits<T> {
+        /// Divisors with a smaller magnitude are treated as zero
+        static constexpr T zeroThreshold = static_cast<T>(kZeroThreshold);
+
+        /// Absolute tolerance of approximatelyEqual()
+        static constexpr T equalityEpsilon = std::is_same_v<T, float> ? T(1e-5) : T(1e-9);
+
+        /**
+         * @brief Checks whether a divisor is treated as zero
+         * @param b Divisor
+         * @return True if |b| < zeroThreshold (false for NaN)
+         */
+        static constexpr bool isNearZero(T b) {
+            return b < zeroThreshold && b > -zeroThreshold;
+        }
+
+        /**
+         * @brief Equality used by BasicCalculator::operator==
+         * @return True if |a - b| < equalityEpsilon
+         */
+        static constexpr bool approximatelyEqual(T a, T b) {
+            T difference = a - b;
+            return difference < equalityEpsilon && difference > -equalityEpsilon;
+        }
+
+        /**
+         * @brief Writes a value as fixed-point text with std::to_chars
+         */
+        static std::to_chars_result toChars(char* first, char* last, T value, int precision) {
+            return std::to_chars(first, last, value, std::chars_format::fixed, precision);
+        }
+    };
+}
+
+#endif // NUMERIC_TRAITS_H
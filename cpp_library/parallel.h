@@ -0,0 +1,89 @@
+/**
+ * @file parallel.h
+ * @brief Minimal fork-join helper shared by the multi-threaded algorithms
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/// @cond INTERNAL
+namespace parallel {
+    /**
+     * @brief Picks a worker count for a job
+     * @param requested Caller's choice, or 0 for the hardware concurrency
+     * @param work Number of items in the job
+     * @param min_per_worker Smallest slice worth handing to a thread
+     * @return Worker count in [1, requested]
+     */
+    inline unsigned workerCount(unsigned requested, std::size_t work, std::size_t min_per_worker) {
+        unsigned workers = requested != 0 ? requested : std::max(1u, std::thread::hardware_concurrency());
+        std::size_t useful = std::max<std::size_t>(1, work / std::max<std::size_t>(1, min_per_worker));
+        return static_cast<unsigned>(std::min<std::size_t>(workers, useful));
+    }
+
+    /**
+     * @brief Runs task(0) .. task(workers - 1) concurrently and waits for all
+     * @param workers Number of tasks; task(0) runs on the calling thread
+     * @param task Callable taking the task index
+     *
+     * If tasks throw, the first exception (by index) is rethrown after every
+     * thread has been joined. If a thread cannot be started, the tasks left
+     * without one run on the calling thread after task(0), so every task
+     * still runs and no started thread is left unjoined.
+     */
+    template <typename Task>
+    void run(unsigned workers, Task task) {
+        std::vector<std::exception_ptr> errors(workers);
+        auto guarded = [&](unsigned index) {
+            try {
+                task(index);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(workers > 0 ? workers - 1 : 0);
+        unsigned started = 1;
+        for (; started < workers; ++started) {
+            try {
+                threads.emplace_back(guarded, started);
+            } catch (const std::system_error&) {
+                break; // Out of threads: the calling thread takes the rest
+            }
+        }
+        if (workers > 0) {
+            guarded(0);
+        }
+        for (unsigned i = started; i < workers; ++i) {
+            guarded(i);
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Start of slice @p index when @p count items are split @p workers ways
+     */
+    inline std::size_t sliceBegin(std::size_t count, unsigned workers, unsigned index) {
+        return count / workers * index + std::min<std::size_t>(index, count % workers);
+    }
+}
+/// @endcond
+
+#endif // PARALLEL_H
@@ -0,0 +1,238 @@
+/**
+ * @file program.cpp
+ * @brief Implementation of the Program class
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "program.h"
+#include "calculator.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    // Values per block in bulk execution; keeps the working set in L1
+    const std::size_t kBlockSize = 1024;
+
+    void applyBlock(const Operation& op, std::span<const double> in, std::span<double> out) {
+        switch (op.code) {
+        case OpCode::Add:
+            MathUtils::add(in, op.operand, out);
+            break;
+        case OpCode::Subtract:
+            MathUtils::subtract(in, op.operand, out);
+            break;
+        case OpCode::Multiply:
+            MathUtils::multiply(in, op.operand, out);
+            break;
+        case OpCode::Divide:
+            MathUtils::divide(in, op.operand, out);
+            break;
+        case OpCode::SetValue:
+            std::fill(out.begin(), out.end(), op.operand);
+            break;
+        case OpCode::Reset:
+            std::fill(out.begin(), out.end(), 0.0);
+            break;
+        }
+    }
+
+    bool overwritesValue(const Operation& op) {
+        return op.code == OpCode::SetValue || op.code == OpCode::Reset;
+    }
+
+    // True if ops[i] is a multiply that Evaluation::Fused merges with the
+    // add or subtract after it
+    bool fusesWithNext(std::span<const Operation> ops, std::size_t i) {
+        return ops[i].code == OpCode::Multiply && i + 1 < ops.size() &&
+               (ops[i + 1].code == OpCode::Add || ops[i + 1].code == OpCode::Subtract);
+    }
+
+    // Third operand of the fma for a fused add or subtract
+    double addend(const Operation& op) {
+        return op.code == OpCode::Add ? op.operand : -op.operand;
+    }
+}
+
+double Operation::apply(double value) const {
+    switch (code) {
+    case OpCode::Add:
+        return MathUtils::add(value, operand);
+    case OpCode::Subtract:
+        return MathUtils::subtract(value, operand);
+    case OpCode::Multiply:
+        return MathUtils::multiply(value, operand);
+    case OpCode::Divide:
+        return MathUtils::divide(value, operand);
+    case OpCode::SetValue:
+        return operand;
+    case OpCode::Reset:
+        return 0.0;
+    }
+    return value;
+}
+
+AffineForm& AffineForm::append(const Operation& op) {
+    switch (op.code) {
+    case OpCode::Add:
+        offset += op.operand;
+        break;
+    case OpCode::Subtract:
+        offset -= op.operand;
+        break;
+    case OpCode::Multiply:
+        scale *= op.operand;
+        offset *= op.operand;
+        break;
+    case OpCode::Divide:
+        scale /= op.operand;
+        offset /= op.operand;
+        break;
+    case OpCode::SetValue:
+        *this = {0.0, op.operand, true};
+        break;
+    case OpCode::Reset:
+        *this = {0.0, 0.0, true};
+        break;
+    }
+    return *this;
+}
+
+double AffineForm::evaluate(double x) const {
+    return constant ? offset : std::fma(scale, x, offset);
+}
+
+Program& Program::append(OpCode code, double operand) {
+    if (code == OpCode::Divide) {
+        // Same validation as MathUtils::divide, done once at record time
+        MathUtils::divide(0.0, operand);
+    }
+    operations_.push_back({code, operand});
+    return *this;
+}
+
+std::span<const Operation> Program::operations() const {
+    return operations_;
+}
+
+std::size_t Program::size() const {
+    return operations_.size();
+}
+
+bool Program::empty() const {
+    return operations_.empty();
+}
+
+double Program::execute(double initial) const {
+    double value = initial;
+    for (const Operation& op : operations_) {
+        value = op.apply(value);
+    }
+    return value;
+}
+
+double Program::execute(double initial, Evaluation mode) const {
+    if (mode == Evaluation::Affine) {
+        return toAffine().evaluate(initial);
+    }
+    double value = initial;
+    for (std::size_t i = 0; i < operations_.size(); ++i) {
+        if (mode == Evaluation::Fused && fusesWithNext(operations_, i)) {
+            value = std::fma(value, operations_[i].operand, addend(operations_[i + 1]));
+            ++i;
+        } else {
+            value = operations_[i].apply(value);
+        }
+    }
+    return value;
+}
+
+void Program::execute(std::span<const double> initial, std::span<double> out) const {
+    execute(initial, out, Evaluation::Exact);
+}
+
+void Program::execute(std::span<const double> initial, std::span<double> out, Evaluation mode) const {
+    if (initial.size() != out.size()) {
+        throw std::invalid_argument("Array sizes do not match");
+    }
+    if (mode == Evaluation::Affine) {
+        AffineForm form = toAffine();
+        if (form.constant) {
+            std::fill(out.begin(), out.end(), form.offset);
+            return;
+        }
+        MathUtils::simd::detail::bulkKernels().fusedMultiplyAdd(initial.data(), form.scale, form.offset,
+                                                               out.data(), initial.size());
+        return;
+    }
+    // Once the chain overwrites the value, every lane follows the same path
+    // from then on, so the whole array shares one scalar result.
+    if (std::any_of(operations_.begin(), operations_.end(), overwritesValue)) {
+        std::fill(out.begin(), out.end(), execute(0.0, mode));
+        return;
+    }
+    if (operations_.empty()) {
+        if (initial.data() != out.data()) {
+            std::copy(initial.begin(), initial.end(), out.begin());
+        }
+        return;
+    }
+    const auto& kernels = MathUtils::simd::detail::bulkKernels();
+    for (std::size_t offset = 0; offset < initial.size(); offset += kBlockSize) {
+        std::size_t count = std::min(kBlockSize, initial.size() - offset);
+        std::span<double> block = out.subspan(offset, count);
+        // The first operation reads the inputs; the rest update the block in place
+        std::span<const double> in = initial.subspan(offset, count);
+        for (std::size_t i = 0; i < operations_.size(); ++i) {
+            if (mode == Evaluation::Fused && fusesWithNext(operations_, i)) {
+                kernels.fusedMultiplyAdd(in.data(), operations_[i].operand, addend(operations_[i + 1]), block.data(),
+                                         count);
+                ++i;
+            } else {
+                applyBlock(operations_[i], in, block);
+            }
+            in = block;
+        }
+    }
+}
+
+AffineForm Program::toAffine() const {
+    AffineForm form = {1.0, 0.0, false};
+    for (const Operation& op : operations_) {
+        form.append(op);
+    }
+    return form;
+}
+
+AffineDeviation Program::affineDeviation(std::span<const double> samples) const {
+    return deviation(samples, Evaluation::Affine);
+}
+
+AffineDeviation Program::deviation(std::span<const double> samples, Evaluation mode) const {
+    AffineForm form = toAffine();
+    AffineDeviation worst = {0.0, 0.0};
+    for (double x : samples) {
+        double exact = execute(x);
+        double other = mode == Evaluation::Affine ? form.evaluate(x) : execute(x, mode);
+        if (std::isnan(exact) || std::isnan(other)) {
+            if (std::isnan(exact) != std::isnan(other)) {
+                worst.absolute = std::numeric_limits<double>::infinity();
+                worst.relative = std::numeric_limits<double>::infinity();
+            }
+            continue;
+        }
+        if (exact == other) {
+            continue;
+        }
+        double error = std::abs(other - exact);
+        worst.absolute = std::max(worst.absolute, error);
+        if (exact != 0.0) {
+            worst.relative = std::max(worst.relative, error / std::abs(exact));
+        }
+    }
+    return worst;
+}
@@ -0,0 +1,282 @@
+/**
+ * @file program.h
+ * @brief Recorded Calculator operation chains that can be replayed in bulk
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A Program is the compact form of a fluent Calculator chain such as
+ * `calc.add(5).multiply(2).subtract(3)`. It is produced by a
+ * RecordingCalculator (recording_calculator.h) and can then be
+ * executed over a whole array of starting values in one pass, instead of
+ * rebuilding the chain once per value.
+ *
+ * Evaluation::Fused replays the chain step by step but turns every
+ * multiply directly followed by an add or subtract, the most common pair
+ * in calculator chains, into one fused multiply-add that rounds once.
+ *
+ * @example
+ * ```cpp
+ * RecordingCalculator calc;
+ * calc.add(5).multiply(2).subtract(3);
+ * Program program = calc.takeProgram();
+ *
+ * std::vector<double> start = {0.0, 1.0, 10.0};
+ * std::vector<double> result(start.size());
+ * program.execute(start, result); // result = {7.0, 9.0, 27.0}
+ * ```
+ */
+
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Calculator operation recorded in a Program
+ */
+enum class OpCode : unsigned char {
+    Add,      ///< value + operand
+    Subtract, ///< value - operand
+    Multiply, ///< value * operand
+    Divide,   ///< value / operand
+    SetValue, ///< value = operand
+    Reset     ///< value = 0
+};
+
+/**
+ * @brief One step of a Program: an operation and its operand
+ *
+ * The operand is ignored for OpCode::Reset.
+ */
+struct Operation {
+    OpCode code;    ///< Operation to apply
+    double operand; ///< Right-hand side of the operation
+
+    /**
+     * @brief Applies the operation to a value
+     * @param value Current value
+     * @return Value after the operation, computed with MathUtils
+     * @throws std::invalid_argument if this is a Divide by zero
+     */
+    double apply(double value) const;
+};
+
+/**
+ * @brief Closed form x -> scale * x + offset of a whole Program
+ *
+ * Every Calculator operation except setValue()/reset() is an affine map,
+ * and affine maps compose, so a chain of any length collapses into a single
+ * (scale, offset) pair. Once the chain overwrites the value the form
+ * becomes a constant and no longer depends on its input.
+ */
+struct AffineForm {
+    double scale;  ///< Multiplier applied to the input
+    double offset; ///< Term added after scaling, or the result if constant
+    bool constant; ///< True if the result ignores the input
+
+    /**
+     * @brief Composes one more operation onto the end of the form
+     * @param op Operation applied after the current form
+     * @return Reference to this form
+     */
+    AffineForm& append(const Operation& op);
+
+    /**
+     * @brief Evaluates the form with a single fused multiply-add
+     * @param x Starting value
+     * @return fma(scale, x, offset), or offset if the form is constant
+     */
+    double evaluate(double x) const;
+};
+
+/**
+ * @brief Difference between an evaluation mode and step-by-step evaluation
+ */
+struct AffineDeviation {
+    double absolute; ///< Largest |other - exact| over the samples
+    double relative; ///< Largest |other - exact| / |exact| over the non-zero exact results
+};
+
+/**
+ * @class Program
+ * @brief A replayable sequence of Calculator operations
+ *
+ * Executing a Program over a single value gives exactly the result of
+ * running the same chain on a Calculator. Executing it over an array
+ * applies each operation to a cache-sized block of values at a time with
+ * the MathUtils bulk kernels, which vectorizes across inputs.
+ */
+class Program {
+private:
+    std::vector<Operation> operations_; ///< Recorded operations, in call order
+
+public:
+    /**
+     * @brief How execute() evaluates the chain
+     *
+     * Fused evaluates each pair multiply(a) -> add(b) as fma(x, a, b) and
+     * multiply(a) -> subtract(b) as fma(x, a, -b): the exact x * a + b,
+     * rounded once, instead of rounding x * a and then the sum. Pairs are
+     * taken left to right, so in multiply, add, add only the first add is
+     * fused. The result differs from Exact only where rounding x * a loses
+     * bits that the sum would have kept:
+     * - Never when x * a is exactly representable (a power of two, or
+     *   small integers), or when b is zero and x * a does not underflow.
+     * - Usually by 1 ulp of the result; fused is the correctly rounded one.
+     * - Under cancellation, x * a close to -b, by far more: for 0.1 * 10 - 1
+     *   Exact gives 0 (the product rounds to 1) and Fused gives 2^-54, the
+     *   true value of the double 0.1 times 10, minus 1.
+     * - When x * a overflows but x * a + b does not: Exact gives ±inf,
+     *   Fused the finite sum.
+     * - In the sign of a zero: a negative product that underflows to -0
+     *   plus b = +0 gives +0 in Exact and -0 in Fused.
+     * NaN and infinite inputs propagate the same way in both. Vector
+     * levels fuse with the FMA instruction; the SSE2 and scalar levels,
+     * which lack one, call std::fma per element and run slower than Exact.
+     */
+    enum class Evaluation {
+        /// Apply every operation in order; matches Calculator bit for bit in
+        /// builds with -ffp-contract=off, see BasicCalculator
+        Exact,
+        Affine, ///< Evaluate the composed AffineForm; faster, but rounds differently
+        Fused   ///< Apply the operations in order, fusing multiply-add pairs; see above
+    };
+
+    /**
+     * @brief Creates an empty program (the identity chain)
+     */
+    Program() = default;
+
+    /**
+     * @brief Appends an operation to the program
+     * @param code Operation to append
+     * @param operand Right-hand side of the operation (ignored for Reset)
+     * @return Reference to this program for chaining
+     * @throws std::invalid_argument if @p code is Divide and @p operand is zero
+     *
+     * Divisors are validated here, once, so execution never has to.
+     */
+    Program& append(OpCode code, double operand = 0.0);
+
+    /**
+     * @brief Gets the recorded operations
+     * @return Operations in the order they are applied
+     */
+    std::span<const Operation> operations() const;
+
+    /**
+     * @brief Gets the number of recorded operations
+     * @return Number of operations
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Checks whether the program has no operations
+     * @return True if the program is the identity chain
+     */
+    bool empty() const;
+
+    /**
+     * @brief Runs the program on one starting value
+     * @param initial Starting value
+     * @return Value a Calculator holds after replaying the chain on @p initial
+     *
+     * @example
+     * ```cpp
+     * Program p;
+     * p.append(OpCode::Add, 5).append(OpCode::Multiply, 2);
+     * double result = p.execute(10.0); // result = 30.0
+     * ```
+     */
+    double execute(double initial) const;
+
+    /**
+     * @brief Runs the program on one starting value
+     * @param initial Starting value
+     * @param mode How to evaluate the chain
+     * @return The value execute(std::span, std::span, Evaluation) gives
+     *         for @p initial
+     *
+     * @example
+     * ```cpp
+     * Program p;
+     * p.append(OpCode::Multiply, 10).append(OpCode::Subtract, 1);
+     * p.execute(0.1);                           // 0.0
+     * p.execute(0.1, Program::Evaluation::Fused); // 5.551115123125783e-17
+     * ```
+     */
+    double execute(double initial, Evaluation mode) const;
+
+    /**
+     * @brief Runs the program on every element of an array
+     * @param initial Starting values
+     * @param out Destination array receiving one result per starting value
+     * @throws std::invalid_argument if the array sizes differ
+     *
+     * Each result is bit-identical to execute(double) on the same input.
+     * @p out may alias @p initial.
+     */
+    void execute(std::span<const double> initial, std::span<double> out) const;
+
+    /**
+     * @brief Runs the program on every element of an array
+     * @param initial Starting values
+     * @param out Destination array receiving one result per starting value
+     * @param mode Evaluation::Exact, Evaluation::Affine to opt in to the
+     *             one-FMA-per-value closed form from toAffine(), or
+     *             Evaluation::Fused to fuse multiply-add pairs
+     * @throws std::invalid_argument if the array sizes differ
+     *
+     * Affine evaluation rounds once per value instead of once per operation,
+     * and Fused once per fused pair, so results may differ from the exact
+     * path in the last bits; use deviation() to measure by how much on
+     * representative inputs. A fused pair also saves one pass over the
+     * block.
+     */
+    void execute(std::span<const double> initial, std::span<double> out, Evaluation mode) const;
+
+    /**
+     * @brief Composes the program into a single affine map
+     * @return Closed form equivalent to the whole chain
+     *
+     * Costs O(size()) once. A constant form is exact; a non-constant form
+     * carries the rounding of the composed coefficients.
+     *
+     * @example
+     * ```cpp
+     * Program p;
+     * p.append(OpCode::Add, 5).append(OpCode::Multiply, 2).append(OpCode::Subtract, 3);
+     * AffineForm f = p.toAffine(); // scale = 2, offset = 7
+     * ```
+     */
+    AffineForm toAffine() const;
+
+    /**
+     * @brief Measures how far affine evaluation drifts from exact evaluation
+     * @param samples Starting values to compare on
+     * @return Largest absolute and relative deviation over @p samples
+     *
+     * Samples where exactly one path yields NaN report an infinite deviation.
+     */
+    AffineDeviation affineDeviation(std::span<const double> samples) const;
+
+    /**
+     * @brief Measures how far an evaluation mode drifts from exact evaluation
+     * @param samples Starting values to compare on
+     * @param mode Evaluation to compare with Evaluation::Exact
+     * @return Largest absolute and relative deviation over @p samples
+     *
+     * Samples where exactly one path yields NaN report an infinite deviation.
+     *
+     * @example
+     * ```cpp
+     * AffineDeviation d = program.deviation(samples, Program::Evaluation::Fused);
+     * ```
+     */
+    AffineDeviation deviation(std::span<const double> samples, Evaluation mode) const;
+};
+
+#endif // PROGRAM_H
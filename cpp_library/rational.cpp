@@ -0,0 +1,348 @@
+/**
+ * @file rational.cpp
+ * @brief Implementation of BasicRational and its explicit instantiations
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "rational.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    // Inline parts stay within ±(2^63 - 1), so negating them never overflows
+    constexpr std::int64_t kInlineMin = -std::numeric_limits<std::int64_t>::max();
+
+    // Overflow-checked arithmetic on inline parts (GCC and Clang builtins)
+    bool checkedAdd(std::int64_t a, std::int64_t b, std::int64_t& out) {
+        return !__builtin_add_overflow(a, b, &out) && out >= kInlineMin;
+    }
+
+    bool checkedMultiply(std::int64_t a, std::int64_t b, std::int64_t& out) {
+        return !__builtin_mul_overflow(a, b, &out) && out >= kInlineMin;
+    }
+
+    std::int64_t gcd(std::int64_t a, std::int64_t b) {
+        return static_cast<std::int64_t>(MathUtils::binaryGcd(static_cast<std::uint64_t>(a < 0 ? -a : a),
+                                                              static_cast<std::uint64_t>(b < 0 ? -b : b)));
+    }
+
+    bool fitsInline(const MathUtils::BigInt& value) {
+        return value.bitLength() < 64;
+    }
+
+    // n / d = a/b + c/d for inline parts with b, d > 0. Unless `reduce`, the
+    // plain cross product is tried first. Otherwise, and on overflow, it
+    // follows Knuth (TAOCP 4.5.1): the gcds are of the small denominators,
+    // and the result is in lowest terms whenever both operands are.
+    bool addInline(std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d, bool reduce, std::int64_t& n,
+                   std::int64_t& den) {
+        std::int64_t ad = 0;
+        std::int64_t cb = 0;
+        if (!reduce) {
+            if (b == d && checkedAdd(a, c, n)) {
+                den = b;
+                return true;
+            }
+            if (b != d && checkedMultiply(a, d, ad) && checkedMultiply(c, b, cb) && checkedAdd(ad, cb, n) &&
+                checkedMultiply(b, d, den)) {
+                return true;
+            }
+        }
+        const std::int64_t g = b == d ? b : gcd(b, d);
+        const std::int64_t b_g = b / g;
+        const std::int64_t d_g = d / g;
+        std::int64_t t = 0;
+        if (!checkedMultiply(a, d_g, ad) || !checkedMultiply(c, b_g, cb) || !checkedAdd(ad, cb, t)) {
+            return false;
+        }
+        // Coprime denominators (g == 1) are the common case and need no
+        // second gcd
+        const std::int64_t g2 = g == 1 ? 1 : gcd(t, g);
+        n = g2 == 1 ? t : t / g2;
+        return checkedMultiply(b_g, g2 == 1 ? d : d / g2, den);
+    }
+
+    // n / den = (a/b) * (c/d), likewise; cross-cancelling before multiplying
+    // keeps reduced operands reduced
+    bool multiplyInline(std::int64_t a, std::int64_t b, std::int64_t c, std::int64_t d, bool reduce,
+                        std::int64_t& n, std::int64_t& den) {
+        if (!reduce && checkedMultiply(a, c, n) && checkedMultiply(b, d, den)) {
+            return true;
+        }
+        // b, d > 0, so neither gcd is zero
+        const std::int64_t g1 = gcd(a, d);
+        const std::int64_t g2 = gcd(c, b);
+        return checkedMultiply(a / g1, c / g2, n) && checkedMultiply(b / g2, d / g1, den);
+    }
+
+    // Inline parts have at most 63 bits, so they only need reducing under a
+    // policy with a lower threshold
+    template <typename Reduction>
+    constexpr bool kReduceInline = Reduction::reduceAboveBits < 63;
+}
+
+namespace MathUtils {
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::fromInline(std::int64_t numerator, std::int64_t denominator) {
+        BasicRational value;
+        value.numerator_ = numerator;
+        value.denominator_ = numerator == 0 ? 1 : denominator;
+        return value;
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::fromParts(BigInt numerator, BigInt denominator, bool reduce) {
+        if (denominator.isNegative()) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        if (reduce || std::max(numerator.bitLength(), denominator.bitLength()) > Reduction::reduceAboveBits) {
+            BigInt g = BigInt::gcd(numerator, denominator);
+            if (g != 1) {
+                numerator /= g;
+                denominator /= g;
+            }
+        }
+        if (fitsInline(numerator) && fitsInline(denominator)) {
+            return fromInline(numerator.toInt64(), denominator.toInt64());
+        }
+        BasicRational value;
+        value.big_numerator_ = std::move(numerator);
+        value.big_denominator_ = std::move(denominator);
+        value.big_ = true;
+        return value;
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction>::BasicRational(std::int64_t value) {
+        if (value < kInlineMin) {
+            *this = fromParts(value, 1, false);
+        } else {
+            numerator_ = value;
+        }
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction>::BasicRational(std::int64_t numerator, std::int64_t denominator) {
+        if (denominator == 0) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        if (numerator < kInlineMin || denominator < kInlineMin) {
+            *this = fromParts(numerator, denominator, false);
+            return;
+        }
+        if (denominator < 0) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        if (kReduceInline<Reduction>) {
+            const std::int64_t g = gcd(numerator, denominator);
+            if (g > 1) {
+                numerator /= g;
+                denominator /= g;
+            }
+        }
+        *this = fromInline(numerator, denominator);
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction>::BasicRational(const BigInt& numerator, const BigInt& denominator) {
+        if (denominator.isZero()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        *this = fromParts(numerator, denominator, false);
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::fromDouble(double value) {
+        if (!std::isfinite(value)) {
+            throw std::invalid_argument("Value is not finite");
+        }
+        // value = mantissa * 2^exponent with an odd 53-bit mantissa, so the
+        // fraction is already in lowest terms
+        int exponent = 0;
+        double fraction = std::frexp(std::fabs(value), &exponent);
+        auto mantissa = static_cast<std::int64_t>(std::ldexp(fraction, 53));
+        exponent -= 53;
+        if (mantissa == 0) {
+            return BasicRational();
+        }
+        const int zeros = std::countr_zero(static_cast<std::uint64_t>(mantissa));
+        mantissa >>= zeros;
+        exponent += zeros;
+        BigInt numerator(std::signbit(value) ? -mantissa : mantissa);
+        if (exponent >= 0) {
+            return fromParts(numerator << static_cast<std::size_t>(exponent), 1, false);
+        }
+        return fromParts(std::move(numerator), BigInt(1) << static_cast<std::size_t>(-exponent), false);
+    }
+
+    template <typename Reduction>
+    BigInt BasicRational<Reduction>::numerator() const {
+        return big_ ? big_numerator_ : BigInt(numerator_);
+    }
+
+    template <typename Reduction>
+    BigInt BasicRational<Reduction>::denominator() const {
+        return big_ ? big_denominator_ : BigInt(denominator_);
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::reduced() const {
+        if (big_) {
+            return fromParts(big_numerator_, big_denominator_, true);
+        }
+        const std::int64_t g = gcd(numerator_, denominator_);
+        return g == 0 ? BasicRational() : fromInline(numerator_ / g, denominator_ / g);
+    }
+
+    template <typename Reduction>
+    double BasicRational<Reduction>::toDouble() const {
+        if (!big_) {
+            return static_cast<double>(numerator_) / static_cast<double>(denominator_);
+        }
+        // Scale to a quotient of about 64 bits, whose truncation is far
+        // below the precision of double
+        const BigInt magnitude = isNegative() ? -big_numerator_ : big_numerator_;
+        const auto shift = 64 + static_cast<std::ptrdiff_t>(big_denominator_.bitLength()) -
+                           static_cast<std::ptrdiff_t>(magnitude.bitLength());
+        const BigInt scaled = shift >= 0 ? (magnitude << static_cast<std::size_t>(shift)) / big_denominator_
+                                         : magnitude / (big_denominator_ << static_cast<std::size_t>(-shift));
+        const double result = std::ldexp(scaled.toDouble(), static_cast<int>(-shift));
+        return isNegative() ? -result : result;
+    }
+
+    template <typename Reduction>
+    std::string BasicRational<Reduction>::toString() const {
+        const BasicRational lowest = reduced();
+        std::string text = lowest.numerator().toString();
+        const BigInt denominator = lowest.denominator();
+        if (denominator != 1) {
+            text += '/';
+            text += denominator.toString();
+        }
+        return text;
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::operator-() const {
+        BasicRational negated = *this;
+        if (big_) {
+            negated.big_numerator_ = -big_numerator_;
+        } else {
+            negated.numerator_ = -numerator_;
+        }
+        return negated;
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::sum(const BasicRational& a, const BasicRational& b) {
+        std::int64_t n = 0;
+        std::int64_t d = 0;
+        if (!a.big_ && !b.big_ &&
+            addInline(a.numerator_, a.denominator_, b.numerator_, b.denominator_, kReduceInline<Reduction>, n, d)) {
+            return fromInline(n, d);
+        }
+        return fromParts(a.numerator() * b.denominator() + b.numerator() * a.denominator(),
+                         a.denominator() * b.denominator(), false);
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::product(const BasicRational& a, const BasicRational& b) {
+        std::int64_t n = 0;
+        std::int64_t d = 0;
+        if (!a.big_ && !b.big_ &&
+            multiplyInline(a.numerator_, a.denominator_, b.numerator_, b.denominator_, kReduceInline<Reduction>, n,
+                           d)) {
+            return fromInline(n, d);
+        }
+        return fromParts(a.numerator() * b.numerator(), a.denominator() * b.denominator(), false);
+    }
+
+    template <typename Reduction>
+    BasicRational<Reduction> BasicRational<Reduction>::quotient(const BasicRational& a, const BasicRational& b) {
+        if (b.isZero()) {
+            throw std::invalid_argument("Division by zero is not allowed");
+        }
+        std::int64_t n = 0;
+        std::int64_t d = 0;
+        if (!a.big_ && !b.big_) {
+            // Multiply by the reciprocal, moving its sign to the numerator
+            const std::int64_t sign = b.numerator_ < 0 ? -1 : 1;
+            if (multiplyInline(a.numerator_, a.denominator_, sign * b.denominator_, sign * b.numerator_,
+                               kReduceInline<Reduction>, n, d)) {
+                return fromInline(n, d);
+            }
+        }
+        return fromParts(a.numerator() * b.denominator(), a.denominator() * b.numerator(), false);
+    }
+
+    template <typename Reduction>
+    std::strong_ordering BasicRational<Reduction>::compare(const BasicRational& a, const BasicRational& b) {
+        if (!a.big_ && !b.big_) {
+            if (a.denominator_ == b.denominator_) {
+                return a.numerator_ <=> b.numerator_;
+            }
+            std::int64_t x = 0;
+            std::int64_t y = 0;
+            if (checkedMultiply(a.numerator_, b.denominator_, x) && checkedMultiply(b.numerator_, a.denominator_, y)) {
+                return x <=> y;
+            }
+        }
+        // Denominators are positive, so cross-multiplying keeps the order
+        return a.numerator() * b.denominator() <=> b.numerator() * a.denominator();
+    }
+
+    template <typename Reduction>
+    std::to_chars_result NumericTraits<BasicRational<Reduction>>::toChars(char* first, char* last,
+                                                                          const BasicRational<Reduction>& value,
+                                                                          int precision) {
+        precision = std::max(precision, 0);
+        BigInt scale = 1;
+        for (int i = 0; i < precision; ++i) {
+            scale *= 10;
+        }
+        // Round |value| * 10^precision half away from zero
+        BigInt numerator = value.numerator();
+        if (numerator.isNegative()) {
+            numerator = -numerator;
+        }
+        const BigInt denominator = value.denominator();
+        BigInt quotient, remainder;
+        BigInt::divMod(numerator * scale, denominator, quotient, remainder);
+        if ((remainder << 1) >= denominator) {
+            quotient += 1;
+        }
+
+        std::string digits = quotient.toString();
+        if (digits.size() <= static_cast<std::size_t>(precision)) {
+            digits.insert(0, static_cast<std::size_t>(precision) + 1 - digits.size(), '0');
+        }
+        const bool negative = value.isNegative();
+        const std::size_t length = negative + digits.size() + (precision > 0);
+        if (static_cast<std::size_t>(last - first) < length) {
+            return {last, std::errc::value_too_large};
+        }
+        if (negative) {
+            *first++ = '-';
+        }
+        const std::size_t integer_digits = digits.size() - static_cast<std::size_t>(precision);
+        first = std::copy_n(digits.begin(), integer_digits, first);
+        if (precision > 0) {
+            *first++ = '.';
+            first = std::copy(digits.begin() + static_cast<std::ptrdiff_t>(integer_digits), digits.end(), first);
+        }
+        return {first, std::errc()};
+    }
+
+    template class BasicRational<EagerReduction>;
+    template class BasicRational<LazyReduction>;
+    template struct NumericTraits<BasicRational<EagerReduction>>;
+    template struct NumericTraits<BasicRational<LazyReduction>>;
+}
@@ -0,0 +1,259 @@
+/**
+ * @file rational.h
+ * @brief Exact rational numbers that never round
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * A rational is a numerator over a positive denominator. Both live in
+ * plain std::int64_t while they fit, and an operation only moves to BigInt
+ * when the 64-bit result would overflow, so the common case of small
+ * fractions costs a few integer multiplications and one binaryGcd().
+ * Results that fit in 64 bits again move back.
+ *
+ * How often fractions are reduced to lowest terms is a compile-time
+ * policy:
+ * - EagerReduction keeps every value in lowest terms, so equal values
+ *   have equal parts. Small values are reduced with the smaller gcds of
+ *   Knuth's formulas (TAOCP 4.5.1) instead of reducing the full product.
+ * - LazyReduction skips the gcd while the parts stay small and reduces
+ *   only once one of them grows past reduceAboveBits bits, which pays off
+ *   on long chains where most intermediate results are never printed.
+ *
+ * RationalCalculator and LazyRationalCalculator (rational_calculator.h)
+ * run the fluent API on them, where divide(7) followed by multiply(7)
+ * gives back exactly the starting value.
+ *
+ * @example
+ * ```cpp
+ * MathUtils::Rational share = MathUtils::Rational(100) / 3; // 100/3
+ * MathUtils::Rational total = share * 3;                    // 100
+ * std::string text = share.toString();                      // "100/3"
+ * ```
+ */
+
+#ifndef RATIONAL_H
+#define RATIONAL_H
+
+#include "big_int.h"
+#include "numeric_traits.h"
+#include <charconv>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace MathUtils {
+    /**
+     * @brief Reduces every result to lowest terms
+     */
+    struct EagerReduction {
+        /// Parts with more bits than this are reduced
+        static constexpr std::size_t reduceAboveBits = 0;
+    };
+
+    /**
+     * @brief Reduces only once the numerator or denominator passes 256 bits
+     *
+     * 64-bit parts are then only reduced when an operation would overflow.
+     * A value that is still larger than the threshold in lowest terms is
+     * reduced again by every operation, as under EagerReduction.
+     */
+    struct LazyReduction {
+        /// Parts with more bits than this are reduced
+        static constexpr std::size_t reduceAboveBits = 256;
+    };
+
+    /**
+     * @class BasicRational
+     * @brief An exact fraction of arbitrary size
+     * @tparam Reduction EagerReduction or LazyReduction, the two policies
+     *         rational.cpp instantiates
+     *
+     * Addition, subtraction, multiplication and division are exact;
+     * dividing by zero throws std::invalid_argument. Comparisons compare
+     * values, so under LazyReduction 2/4 == 1/2 even though the parts
+     * differ.
+     *
+     * Converts implicitly from std::int64_t, which lets it stand in for the
+     * value type of BasicCalculator (see RationalCalculator).
+     */
+    template <typename Reduction>
+    class BasicRational {
+    private:
+        std::int64_t numerator_ = 0;   ///< Numerator while the value is inline
+        std::int64_t denominator_ = 1; ///< Denominator while inline, always > 0
+        BigInt big_numerator_;         ///< Numerator once it no longer fits inline
+        BigInt big_denominator_;       ///< Denominator once it no longer fits inline, > 0
+        bool big_ = false;             ///< Which of the two representations is in use
+
+        static BasicRational fromInline(std::int64_t numerator, std::int64_t denominator);
+        static BasicRational fromParts(BigInt numerator, BigInt denominator, bool reduce);
+
+        static BasicRational sum(const BasicRational& a, const BasicRational& b);
+        static BasicRational product(const BasicRational& a, const BasicRational& b);
+        static BasicRational quotient(const BasicRational& a, const BasicRational& b);
+        static std::strong_ordering compare(const BasicRational& a, const BasicRational& b);
+
+    public:
+        /**
+         * @brief Creates zero
+         */
+        BasicRational() = default;
+
+        /**
+         * @brief Creates a rational equal to an integer
+         * @param value Initial value
+         */
+        BasicRational(std::int64_t value);
+
+        /**
+         * @brief Creates the fraction numerator / denominator
+         * @param numerator Numerator
+         * @param denominator Denominator, of either sign
+         * @throws std::invalid_argument if denominator is zero
+         */
+        BasicRational(std::int64_t numerator, std::int64_t denominator);
+
+        /**
+         * @brief Creates the fraction numerator / denominator from big parts
+         * @param numerator Numerator
+         * @param denominator Denominator, of either sign
+         * @throws std::invalid_argument if denominator is zero
+         */
+        BasicRational(const BigInt& numerator, const BigInt& denominator);
+
+        /**
+         * @brief Converts a double exactly
+         * @param value Finite value; every double is a fraction m / 2^k
+         * @return The same value, in lowest terms
+         * @throws std::invalid_argument if value is infinite or NaN
+         *
+         * @example
+         * ```cpp
+         * auto tenth = MathUtils::Rational::fromDouble(0.1); // 3602879701896397/36028797018963968
+         * ```
+         */
+        static BasicRational fromDouble(double value);
+
+        /**
+         * @brief Gets the numerator as stored
+         * @return Numerator, which carries the sign; not necessarily in
+         *         lowest terms under LazyReduction, see reduced()
+         */
+        BigInt numerator() const;
+
+        /**
+         * @brief Gets the denominator as stored
+         * @return Denominator, always positive
+         */
+        BigInt denominator() const;
+
+        /**
+         * @brief Checks for zero
+         * @return True if the value is zero
+         */
+        bool isZero() const {
+            return big_ ? big_numerator_.isZero() : numerator_ == 0;
+        }
+
+        /**
+         * @brief Checks the sign
+         * @return True if the value is below zero
+         */
+        bool isNegative() const {
+            return big_ ? big_numerator_.isNegative() : numerator_ < 0;
+        }
+
+        /**
+         * @brief Gets the value in lowest terms
+         * @return Equal value whose numerator and denominator are coprime
+         */
+        BasicRational reduced() const;
+
+        /**
+         * @brief Converts to double
+         * @return The value within about one ulp, or ±infinity if out of range
+         */
+        double toDouble() const;
+
+        /**
+         * @brief Formats as a fraction in lowest terms
+         * @return "numerator/denominator", or only the numerator for integers
+         */
+        std::string toString() const;
+
+        BasicRational operator-() const;
+
+        friend BasicRational operator+(const BasicRational& a, const BasicRational& b) {
+            return sum(a, b);
+        }
+
+        friend BasicRational operator-(const BasicRational& a, const BasicRational& b) {
+            return sum(a, -b);
+        }
+
+        friend BasicRational operator*(const BasicRational& a, const BasicRational& b) {
+            return product(a, b);
+        }
+
+        /// @throws std::invalid_argument if b is zero
+        friend BasicRational operator/(const BasicRational& a, const BasicRational& b) {
+            return quotient(a, b);
+        }
+
+        BasicRational& operator+=(const BasicRational& other) {
+            return *this = *this + other;
+        }
+
+        BasicRational& operator-=(const BasicRational& other) {
+            return *this = *this - other;
+        }
+
+        BasicRational& operator*=(const BasicRational& other) {
+            return *this = *this * other;
+        }
+
+        BasicRational& operator/=(const BasicRational& other) {
+            return *this = *this / other;
+        }
+
+        friend bool operator==(const BasicRational& a, const BasicRational& b) {
+            return compare(a, b) == 0;
+        }
+
+        friend std::strong_ordering operator<=>(const BasicRational& a, const BasicRational& b) {
+            return compare(a, b);
+        }
+    };
+
+    /**
+     * @brief Rationals kept in lowest terms after every operation
+     */
+    using Rational = BasicRational<EagerReduction>;
+
+    /**
+     * @brief Rationals reduced only once their parts grow large
+     */
+    using LazyRational = BasicRational<LazyReduction>;
+
+    /**
+     * @brief Numeric rules for rationals: exact, printed as a decimal
+     *        rounded half away from zero to `precision` places
+     */
+    template <typename Reduction>
+    struct NumericTraits<BasicRational<Reduction>> {
+        static bool isNearZero(const BasicRational<Reduction>& b) {
+            return b.isZero();
+        }
+
+        static bool approximatelyEqual(const BasicRational<Reduction>& a, const BasicRational<Reduction>& b) {
+            return a == b;
+        }
+
+        static std::to_chars_result toChars(char* first, char* last, const BasicRational<Reduction>& value,
+                                            int precision);
+    };
+}
+
+#endif // RATIONAL_H
@@ -0,0 +1,16 @@
+/**
+ * @file rational_calculator.cpp
+ * @brief Explicit instantiations of BasicCalculator on exact fractions
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "rational_calculator.h"
+
+#ifndef CALCULATOR_HEADER_ONLY
+#include "calculator_inline.h"
+#endif
+
+template class BasicCalculator<MathUtils::Rational, MathUtils::ThrowingDivision>;
+template class BasicCalculator<MathUtils::LazyRational, MathUtils::ThrowingDivision>;
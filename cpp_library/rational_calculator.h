@@ -0,0 +1,39 @@
+/**
+ * @file rational_calculator.h
+ * @brief BasicCalculator on the exact fractions of rational.h
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Kept out of calculator.h so that code using only Calculator does not
+ * parse Rational and BigInt.
+ *
+ * @example
+ * ```cpp
+ * #include "rational_calculator.h"
+ *
+ * RationalCalculator share(MathUtils::Rational(1));
+ * share.divide(MathUtils::Rational(3)); // exactly 1/3
+ * ```
+ */
+
+#ifndef RATIONAL_CALCULATOR_H
+#define RATIONAL_CALCULATOR_H
+
+#include "calculator.h"
+#include "rational.h"
+
+/**
+ * @brief Calculator on exact fractions, see rational.h
+ *
+ * Nothing is ever rounded: divide(3) followed by multiply(3) restores the
+ * value exactly. toString() rounds only the printed decimals.
+ */
+using RationalCalculator = BasicCalculator<MathUtils::Rational, MathUtils::ThrowingDivision>;
+
+/**
+ * @brief RationalCalculator that defers reducing fractions, see LazyReduction
+ */
+using LazyRationalCalculator = BasicCalculator<MathUtils::LazyRational, MathUtils::ThrowingDivision>;
+
+#endif // RATIONAL_CALCULATOR_H
@@ -0,0 +1,75 @@
+/**
+ * @file recording_calculator.cpp
+ * @brief Implementation of RecordingCalculator
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "recording_calculator.h"
+#include <utility>
+
+RecordingCalculator::RecordingCalculator(double initial_value) : calculator_(initial_value) {
+}
+
+double RecordingCalculator::getValue() const {
+    return calculator_.getValue();
+}
+
+const Calculator& RecordingCalculator::calculator() const {
+    return calculator_;
+}
+
+const Program& RecordingCalculator::program() const {
+    return program_;
+}
+
+Program RecordingCalculator::takeProgram() {
+    return std::exchange(program_, Program());
+}
+
+RecordingCalculator& RecordingCalculator::setValue(double value) {
+    calculator_.setValue(value);
+    program_.append(OpCode::SetValue, value);
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::add(double value) {
+    calculator_.add(value);
+    program_.append(OpCode::Add, value);
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::subtract(double value) {
+    calculator_.subtract(value);
+    program_.append(OpCode::Subtract, value);
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::multiply(double value) {
+    calculator_.multiply(value);
+    program_.append(OpCode::Multiply, value);
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::divide(double value) {
+    calculator_.divide(value);
+    program_.append(OpCode::Divide, value);
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::divide(const MathUtils::Divisor<double>& divisor) {
+    calculator_.divide(divisor);
+    program_.append(OpCode::Divide, divisor.value());
+    return *this;
+}
+
+RecordingCalculator& RecordingCalculator::reset() {
+    calculator_.reset();
+    program_.append(OpCode::Reset);
+    return *this;
+}
+
+std::string RecordingCalculator::toString(int precision) const {
+    return calculator_.toString(precision);
+}
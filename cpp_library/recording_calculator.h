@@ -0,0 +1,147 @@
+/**
+ * @file recording_calculator.h
+ * @brief A Calculator that captures its operations into a Program
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Recording is a separate type rather than a mode of Calculator, so a
+ * plain Calculator stays a single trivially copyable double and never
+ * pays for a Program it cannot use.
+ *
+ * @example
+ * ```cpp
+ * RecordingCalculator calc;
+ * calc.add(5).multiply(2).subtract(3);
+ * Program program = calc.takeProgram();
+ *
+ * std::vector<double> start = {0.0, 1.0, 10.0};
+ * std::vector<double> result(start.size());
+ * program.execute(start, result); // result = {7.0, 9.0, 27.0}
+ * ```
+ */
+
+#ifndef RECORDING_CALCULATOR_H
+#define RECORDING_CALCULATOR_H
+
+#include "calculator.h"
+#include "program.h"
+#include <string>
+
+/**
+ * @class RecordingCalculator
+ * @brief Calculator whose operations are also appended to a Program
+ *
+ * setValue(), add(), subtract(), multiply(), divide() and reset() update
+ * the current value exactly as Calculator does, and append the operation
+ * to a Program retrieved with takeProgram(). The starting value is not
+ * part of the program: executing it replays the chain on any starting
+ * value, and on the one this calculator started from gives getValue()
+ * bit for bit as long as the build does not contract floating-point
+ * expressions (-ffp-contract=off, see BasicCalculator).
+ *
+ * A division by zero throws before anything is recorded, as on
+ * Calculator.
+ */
+class RecordingCalculator {
+private:
+    Calculator calculator_; ///< Current value
+    Program program_;       ///< Operations captured since construction or takeProgram()
+
+public:
+    /**
+     * @brief Creates a calculator at zero with an empty program
+     */
+    RecordingCalculator() = default;
+
+    /**
+     * @brief Creates a calculator with an initial value and an empty program
+     * @param initial_value Starting value, not recorded
+     */
+    explicit RecordingCalculator(double initial_value);
+
+    /**
+     * @brief Gets the current value
+     * @return Current calculator value
+     */
+    double getValue() const;
+
+    /**
+     * @brief Gets the underlying calculator
+     * @return Calculator holding the current value
+     */
+    const Calculator& calculator() const;
+
+    /**
+     * @brief Gets the operations captured so far
+     * @return Program holding every recorded operation
+     */
+    const Program& program() const;
+
+    /**
+     * @brief Returns the captured operations and starts an empty program
+     * @return Program holding every operation since construction or the
+     *         previous call
+     *
+     * The current value is kept, so recording carries on from it.
+     */
+    Program takeProgram();
+
+    /**
+     * @brief Sets the value, recording OpCode::SetValue
+     * @param value New value to set
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& setValue(double value);
+
+    /**
+     * @brief Adds a value, recording OpCode::Add
+     * @param value Value to add
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& add(double value);
+
+    /**
+     * @brief Subtracts a value, recording OpCode::Subtract
+     * @param value Value to subtract
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& subtract(double value);
+
+    /**
+     * @brief Multiplies by a value, recording OpCode::Multiply
+     * @param value Value to multiply by
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& multiply(double value);
+
+    /**
+     * @brief Divides by a value, recording OpCode::Divide
+     * @param value Value to divide by
+     * @return Reference to this calculator for chaining
+     * @throws std::invalid_argument if value is zero; nothing is recorded
+     */
+    RecordingCalculator& divide(double value);
+
+    /**
+     * @brief Divides by a prepared divisor, recording OpCode::Divide
+     * @param divisor Divisor, validated when it was built
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& divide(const MathUtils::Divisor<double>& divisor);
+
+    /**
+     * @brief Resets the value to zero, recording OpCode::Reset
+     * @return Reference to this calculator for chaining
+     */
+    RecordingCalculator& reset();
+
+    /**
+     * @brief Converts the current value to string
+     * @param precision Number of decimal places (default: 2)
+     * @return String representation of the current value, see Calculator::toString()
+     */
+    std::string toString(int precision = 2) const;
+};
+
+#endif // RECORDING_CALCULATOR_H
@@ -0,0 +1,416 @@
+/**
+ * @file reduction.cpp
+ * @brief Implementation of the reproducible sum and dot product
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "reduction.h"
+#include "compensated.h"
+#include "parallel.h"
+#include "simd_dispatch.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    // Part of the definition of a Blocked result: changing either constant
+    // changes the bits produced
+    const std::size_t kBlockSize = 1 << 12;
+    constexpr std::size_t kLanes = 8;
+
+    // Below this many blocks per thread, spawning costs more than it saves
+    const std::size_t kMinBlocksPerWorker = 16;
+
+    // Sum of one block, with the rounding error carried alongside when
+    // compensating
+    struct Partial {
+        double sum;
+        double compensation;
+    };
+
+    // Block kernels: lane j accumulates elements j, j + 8, ... of the block
+    // in order, then the lanes combine in a fixed order. The loops vectorize
+    // without reordering anything, so every ISA gives the same bits.
+
+    inline double combineLanes(const double (&lanes)[kLanes]) {
+        return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+
+    inline Partial combineLanes(const double (&sums)[kLanes], const double (&errors)[kLanes]) {
+        Partial total{sums[0], errors[0]};
+        for (std::size_t j = 1; j < kLanes; ++j) {
+            double error = 0.0;
+            total.sum = MathUtils::twoSum(total.sum, sums[j], error);
+            total.compensation += error + errors[j];
+        }
+        return total;
+    }
+
+    inline Partial sumBlockImpl(const double* x, std::size_t n) {
+        double lanes[kLanes] = {};
+        std::size_t i = 0;
+        for (; i + kLanes <= n; i += kLanes) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                lanes[j] += x[i + j];
+            }
+        }
+        for (std::size_t j = 0; i < n; ++i, ++j) {
+            lanes[j] += x[i];
+        }
+        return {combineLanes(lanes), 0.0};
+    }
+
+    inline Partial dotBlockImpl(const double* a, const double* b, std::size_t n) {
+        double lanes[kLanes] = {};
+        std::size_t i = 0;
+        for (; i + kLanes <= n; i += kLanes) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                lanes[j] = std::fma(a[i + j], b[i + j], lanes[j]);
+            }
+        }
+        for (std::size_t j = 0; i < n; ++i, ++j) {
+            lanes[j] = std::fma(a[i], b[i], lanes[j]);
+        }
+        return {combineLanes(lanes), 0.0};
+    }
+
+    inline void compensatedAdd(double& sum, double& errors, double x) {
+        double error = 0.0;
+        sum = MathUtils::twoSum(sum, x, error);
+        errors += error;
+    }
+
+    inline Partial compensatedSumBlockImpl(const double* x, std::size_t n) {
+        double sums[kLanes] = {};
+        double errors[kLanes] = {};
+        std::size_t i = 0;
+        for (; i + kLanes <= n; i += kLanes) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                compensatedAdd(sums[j], errors[j], x[i + j]);
+            }
+        }
+        for (std::size_t j = 0; i < n; ++i, ++j) {
+            compensatedAdd(sums[j], errors[j], x[i]);
+        }
+        return combineLanes(sums, errors);
+    }
+
+    // Dot2: the product error comes from fma, the sum error from TwoSum
+    inline void compensatedMultiplyAdd(double& sum, double& errors, double a, double b) {
+        double product = a * b;
+        double product_error = std::fma(a, b, -product);
+        double error = 0.0;
+        sum = MathUtils::twoSum(sum, product, error);
+        errors += error + product_error;
+    }
+
+    inline Partial compensatedDotBlockImpl(const double* a, const double* b, std::size_t n) {
+        double sums[kLanes] = {};
+        double errors[kLanes] = {};
+        std::size_t i = 0;
+        for (; i + kLanes <= n; i += kLanes) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                compensatedMultiplyAdd(sums[j], errors[j], a[i + j], b[i + j]);
+            }
+        }
+        for (std::size_t j = 0; i < n; ++i, ++j) {
+            compensatedMultiplyAdd(sums[j], errors[j], a[i], b[i]);
+        }
+        return combineLanes(sums, errors);
+    }
+
+    using SumBlock = Partial (*)(const double*, std::size_t);
+    using DotBlock = Partial (*)(const double*, const double*, std::size_t);
+
+    // Block kernels for one ISA, indexed by plain/compensated
+    struct BlockKernels {
+        SumBlock sum[2];
+        DotBlock dot[2];
+    };
+
+    Partial sumBlockPortable(const double* x, std::size_t n) {
+        return sumBlockImpl(x, n);
+    }
+
+    Partial dotBlockPortable(const double* a, const double* b, std::size_t n) {
+        return dotBlockImpl(a, b, n);
+    }
+
+    Partial compensatedSumBlockPortable(const double* x, std::size_t n) {
+        return compensatedSumBlockImpl(x, n);
+    }
+
+    Partial compensatedDotBlockPortable(const double* a, const double* b, std::size_t n) {
+        return compensatedDotBlockImpl(a, b, n);
+    }
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // Same source, compiled for 256-bit vectors and a hardware fma
+
+    __attribute__((target("avx2,fma"))) Partial sumBlockAvx2(const double* x, std::size_t n) {
+        return sumBlockImpl(x, n);
+    }
+
+    __attribute__((target("avx2,fma"))) Partial dotBlockAvx2(const double* a, const double* b, std::size_t n) {
+        return dotBlockImpl(a, b, n);
+    }
+
+    __attribute__((target("avx2,fma"))) Partial compensatedSumBlockAvx2(const double* x, std::size_t n) {
+        return compensatedSumBlockImpl(x, n);
+    }
+
+    __attribute__((target("avx2,fma")))
+    Partial compensatedDotBlockAvx2(const double* a, const double* b, std::size_t n) {
+        return compensatedDotBlockImpl(a, b, n);
+    }
+#endif
+
+    BlockKernels makeBlockKernels() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        if (MathUtils::simd::activeLevel() >= MathUtils::simd::IsaLevel::AVX2) {
+            return {{sumBlockAvx2, compensatedSumBlockAvx2}, {dotBlockAvx2, compensatedDotBlockAvx2}};
+        }
+#endif
+        return {{sumBlockPortable, compensatedSumBlockPortable}, {dotBlockPortable, compensatedDotBlockPortable}};
+    }
+
+    const BlockKernels& blockKernels() {
+        static const BlockKernels kernels = makeBlockKernels();
+        return kernels;
+    }
+
+    // Exact fixed-point accumulator for doubles. Bit 0 of limb 0 weighs
+    // 2^-1074, the smallest subnormal, and the limbs reach well past
+    // DBL_MAX, so every finite double is an integer in this representation
+    // and sums are exact. Each limb holds 32 value bits in an int64, which
+    // leaves room for 2^31 unnormalized additions.
+    class ExactAccumulator {
+    private:
+        static constexpr int kLimbBits = 32;
+        static constexpr int kLimbs = 70; // 2046 exponents + 53 bits + 64 bits of carry
+        static constexpr std::uint64_t kPendingLimit = std::uint64_t(1) << 30;
+
+        std::int64_t limbs_[kLimbs] = {};
+        std::uint64_t pending_ = 0; // Additions since the last normalization
+        bool nan_ = false;
+        bool positive_infinity_ = false;
+        bool negative_infinity_ = false;
+
+        // Moves carries up so limbs 0 .. kLimbs - 2 lie in [0, 2^32); the top
+        // limb keeps the sign
+        void normalize() {
+            for (int i = 0; i + 1 < kLimbs; ++i) {
+                std::int64_t carry = limbs_[i] >> kLimbBits;
+                limbs_[i] &= 0xFFFFFFFF;
+                limbs_[i + 1] += carry;
+            }
+            pending_ = 0;
+        }
+
+        std::uint64_t limb(int index) const {
+            return index >= 0 ? static_cast<std::uint64_t>(limbs_[index]) : 0;
+        }
+
+    public:
+        void add(double x) {
+            std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+            int biased = static_cast<int>((bits >> 52) & 0x7FF);
+            std::uint64_t mantissa = bits & ((std::uint64_t(1) << 52) - 1);
+            bool negative = (bits >> 63) != 0;
+            if (biased == 0x7FF) {
+                if (mantissa != 0) {
+                    nan_ = true;
+                } else if (negative) {
+                    negative_infinity_ = true;
+                } else {
+                    positive_infinity_ = true;
+                }
+                return;
+            }
+            // x = mantissa * 2^(position - 1074)
+            int position = 0;
+            if (biased != 0) {
+                mantissa |= std::uint64_t(1) << 52;
+                position = biased - 1;
+            }
+            int index = position / kLimbBits;
+            int shift = position % kLimbBits;
+            auto low = static_cast<std::int64_t>((mantissa << shift) & 0xFFFFFFFF);
+            std::uint64_t upper = mantissa >> (kLimbBits - shift);
+            auto middle = static_cast<std::int64_t>(upper & 0xFFFFFFFF);
+            auto high = static_cast<std::int64_t>(upper >> kLimbBits);
+            if (negative) {
+                limbs_[index] -= low;
+                limbs_[index + 1] -= middle;
+                limbs_[index + 2] -= high;
+            } else {
+                limbs_[index] += low;
+                limbs_[index + 1] += middle;
+                limbs_[index + 2] += high;
+            }
+            if (++pending_ == kPendingLimit) {
+                normalize();
+            }
+        }
+
+        void merge(ExactAccumulator& other) {
+            normalize();
+            other.normalize();
+            for (int i = 0; i < kLimbs; ++i) {
+                limbs_[i] += other.limbs_[i];
+            }
+            pending_ = 1;
+            nan_ |= other.nan_;
+            positive_infinity_ |= other.positive_infinity_;
+            negative_infinity_ |= other.negative_infinity_;
+        }
+
+        // Rounds the exact total to the nearest double, ties to even
+        double round() {
+            if (nan_ || (positive_infinity_ && negative_infinity_)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (positive_infinity_ || negative_infinity_) {
+                return positive_infinity_ ? std::numeric_limits<double>::infinity()
+                                          : -std::numeric_limits<double>::infinity();
+            }
+            normalize();
+            bool negative = limbs_[kLimbs - 1] < 0;
+            if (negative) {
+                for (std::int64_t& limb : limbs_) {
+                    limb = -limb;
+                }
+                normalize();
+            }
+            int top = kLimbs - 1;
+            while (top >= 0 && limbs_[top] == 0) {
+                --top;
+            }
+            if (top < 0) {
+                return 0.0;
+            }
+
+            // Gather the 64 most significant bits; everything below is sticky
+            int width = std::bit_width(limb(top)); // 1 .. 32
+            std::uint64_t window = (limb(top) << (64 - width)) | (limb(top - 1) << (kLimbBits - width)) |
+                                   (limb(top - 2) >> width);
+            bool sticky = (limb(top - 2) & ((std::uint64_t(1) << width) - 1)) != 0;
+            for (int i = top - 3; i >= 0 && !sticky; --i) {
+                sticky = limbs_[i] != 0;
+            }
+
+            // Keep 53 bits. A subnormal total has at most 52 significant
+            // bits, so nothing is dropped and the ldexp below is exact.
+            std::uint64_t kept = window >> 11;
+            std::uint64_t rest = window & 0x7FF;
+            if (rest > 0x400 || (rest == 0x400 && (sticky || (kept & 1) != 0))) {
+                ++kept;
+            }
+            int exponent = kLimbBits * (top - 2) + width + 11 - 1074;
+            double magnitude = std::ldexp(static_cast<double>(kept), exponent);
+            return negative ? -magnitude : magnitude;
+        }
+    };
+
+    std::size_t blockCount(std::size_t n) {
+        return (n + kBlockSize - 1) / kBlockSize;
+    }
+
+    // Runs body(worker, first_block, last_block) on every worker. The split
+    // only decides who computes which blocks, never the order of operations.
+    template <typename Body>
+    void forBlocks(std::size_t n, unsigned workers, Body body) {
+        const std::size_t blocks = blockCount(n);
+        parallel::run(workers, [&](unsigned w) {
+            body(w, parallel::sliceBegin(blocks, workers, w), parallel::sliceBegin(blocks, workers, w + 1));
+        });
+    }
+
+    double addInOrder(const std::vector<Partial>& partials, bool compensated) {
+        Partial total{0.0, 0.0};
+        for (const Partial& partial : partials) {
+            if (compensated) {
+                compensatedAdd(total.sum, total.compensation, partial.sum);
+                total.compensation += partial.compensation;
+            } else {
+                total.sum += partial.sum;
+            }
+        }
+        return total.sum + total.compensation;
+    }
+}
+
+namespace MathUtils {
+    double sum(std::span<const double> values, const ReduceOptions& options) {
+        const std::size_t n = values.size();
+        const unsigned workers = parallel::workerCount(options.threads, blockCount(n), kMinBlocksPerWorker);
+        if (options.accumulation == Accumulation::Exact) {
+            std::vector<ExactAccumulator> accumulators(workers);
+            forBlocks(n, workers, [&](unsigned w, std::size_t first, std::size_t last) {
+                const std::size_t end = std::min(n, last * kBlockSize);
+                for (std::size_t i = first * kBlockSize; i < end; ++i) {
+                    accumulators[w].add(values[i]);
+                }
+            });
+            for (std::size_t w = 1; w < accumulators.size(); ++w) {
+                accumulators[0].merge(accumulators[w]);
+            }
+            return accumulators[0].round();
+        }
+
+        const bool compensated = options.accumulation == Accumulation::Compensated;
+        const SumBlock kernel = blockKernels().sum[compensated];
+        std::vector<Partial> partials(blockCount(n));
+        forBlocks(n, workers, [&](unsigned, std::size_t first, std::size_t last) {
+            for (std::size_t block = first; block < last; ++block) {
+                const std::size_t begin = block * kBlockSize;
+                partials[block] = kernel(values.data() + begin, std::min(kBlockSize, n - begin));
+            }
+        });
+        return addInOrder(partials, compensated);
+    }
+
+    double dot(std::span<const double> a, std::span<const double> b, const ReduceOptions& options) {
+        if (a.size() != b.size()) {
+            throw std::invalid_argument("Array sizes do not match");
+        }
+        const std::size_t n = a.size();
+        const unsigned workers = parallel::workerCount(options.threads, blockCount(n), kMinBlocksPerWorker);
+        if (options.accumulation == Accumulation::Exact) {
+            std::vector<ExactAccumulator> accumulators(workers);
+            forBlocks(n, workers, [&](unsigned w, std::size_t first, std::size_t last) {
+                const std::size_t end = std::min(n, last * kBlockSize);
+                for (std::size_t i = first * kBlockSize; i < end; ++i) {
+                    // product + error == a[i] * b[i] exactly (TwoProd)
+                    double product = a[i] * b[i];
+                    accumulators[w].add(product);
+                    if (std::isfinite(product)) {
+                        accumulators[w].add(std::fma(a[i], b[i], -product));
+                    }
+                }
+            });
+            for (std::size_t w = 1; w < accumulators.size(); ++w) {
+                accumulators[0].merge(accumulators[w]);
+            }
+            return accumulators[0].round();
+        }
+
+        const bool compensated = options.accumulation == Accumulation::Compensated;
+        const DotBlock kernel = blockKernels().dot[compensated];
+        std::vector<Partial> partials(blockCount(n));
+        forBlocks(n, workers, [&](unsigned, std::size_t first, std::size_t last) {
+            for (std::size_t block = first; block < last; ++block) {
+                const std::size_t begin = block * kBlockSize;
+                partials[block] = kernel(a.data() + begin, b.data() + begin, std::min(kBlockSize, n - begin));
+            }
+        });
+        return addInOrder(partials, compensated);
+    }
+}
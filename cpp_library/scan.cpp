@@ -0,0 +1,101 @@
+/**
+ * @file scan.cpp
+ * @brief Implementation of the parallel operation scan
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "scan.h"
+#include "parallel.h"
+#include <stdexcept>
+
+namespace {
+    // Below this many operations per thread, spawning costs more than it saves
+    const std::size_t kMinOpsPerWorker = 1 << 15;
+
+    bool overwritesValue(const Operation& op) {
+        return op.code == OpCode::SetValue || op.code == OpCode::Reset;
+    }
+
+    void replay(std::span<const Operation> ops, std::size_t begin, std::size_t end, double value,
+                std::span<double> out) {
+        for (std::size_t i = begin; i < end; ++i) {
+            value = ops[i].apply(value);
+            out[i] = value;
+        }
+    }
+
+    void scanExact(std::span<const Operation> ops, double initial, std::span<double> out, unsigned threads) {
+        const std::size_t n = ops.size();
+        const unsigned workers = parallel::workerCount(threads, n, kMinOpsPerWorker);
+        // Each worker owns the segments that start inside its slice, where a
+        // segment runs from one value-overwriting operation to the next. The
+        // first segment starts from the caller's initial value instead.
+        parallel::run(workers, [&](unsigned w) {
+            const std::size_t slice_end = parallel::sliceBegin(n, workers, w + 1);
+            std::size_t begin = parallel::sliceBegin(n, workers, w);
+            if (w != 0) {
+                while (begin < slice_end && !overwritesValue(ops[begin])) {
+                    ++begin;
+                }
+                if (begin == slice_end) {
+                    return;
+                }
+            }
+            std::size_t end = slice_end;
+            while (end < n && !overwritesValue(ops[end])) {
+                ++end;
+            }
+            replay(ops, begin, end, initial, out);
+        });
+    }
+
+    void scanAffine(std::span<const Operation> ops, double initial, std::span<double> out, unsigned threads) {
+        const std::size_t n = ops.size();
+        const unsigned workers = parallel::workerCount(threads, n, kMinOpsPerWorker);
+
+        // Up-sweep: compose each slice into one map
+        std::vector<AffineForm> forms(workers, AffineForm{1.0, 0.0, false});
+        parallel::run(workers, [&](unsigned w) {
+            const std::size_t end = parallel::sliceBegin(n, workers, w + 1);
+            for (std::size_t i = parallel::sliceBegin(n, workers, w); i < end; ++i) {
+                forms[w].append(ops[i]);
+            }
+        });
+
+        // Exclusive scan of the slice maps gives every slice its start value
+        std::vector<double> starts(workers);
+        starts[0] = initial;
+        for (unsigned w = 1; w < workers; ++w) {
+            starts[w] = forms[w - 1].evaluate(starts[w - 1]);
+        }
+
+        // Down-sweep: replay each slice step by step from its start value
+        parallel::run(workers, [&](unsigned w) {
+            replay(ops, parallel::sliceBegin(n, workers, w), parallel::sliceBegin(n, workers, w + 1),
+                   starts[w], out);
+        });
+    }
+}
+
+void scan(std::span<const Operation> ops, double initial, std::span<double> out, ScanMode mode,
+          unsigned threads) {
+    if (ops.size() != out.size()) {
+        throw std::invalid_argument("Array sizes do not match");
+    }
+    if (ops.empty()) {
+        return;
+    }
+    if (mode == ScanMode::Exact) {
+        scanExact(ops, initial, out, threads);
+    } else {
+        scanAffine(ops, initial, out, threads);
+    }
+}
+
+std::vector<double> scan(std::span<const Operation> ops, double initial, ScanMode mode, unsigned threads) {
+    std::vector<double> out(ops.size());
+    scan(ops, initial, out, mode, threads);
+    return out;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file scan.h
+ * @brief Parallel prefix scan over a stream of Calculator operations
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Auditing an operation log means producing the value a Calculator holds
+ * after every single operation. Walking the log on one Calculator is
+ * strictly sequential; the functions here split the log across threads.
+ *
+ * @example
+ * ```cpp
+ * std::vector<Operation> log = {{OpCode::Add, 5}, {OpCode::Multiply, 2}, {OpCode::Subtract, 3}};
+ * std::vector<double> values = scan(log, 10.0); // {15.0, 30.0, 27.0}
+ * ```
+ */
+
+#ifndef SCAN_H
+#define SCAN_H
+
+#include "program.h"
+#include <span>
+#include <vector>
+
+/**
+ * @brief Trade-off between reproducibility and parallelism in scan()
+ */
+enum class ScanMode {
+    /**
+     * Results are bit-identical to replaying the stream on one Calculator.
+     * Only setValue()/reset() give an exactly known intermediate value, so
+     * the stream is split at those points and the segments run in parallel;
+     * a stream without them runs on a single thread.
+     */
+    Exact,
+    /**
+     * Every thread composes its slice of the stream into an AffineForm, the
+     * slice start values are derived from those forms, and each slice is
+     * then replayed step by step. Scales with thread count on any stream,
+     * but a slice start may differ from the sequential value by the
+     * rounding of the composed form (see Program::affineDeviation()).
+     */
+    Affine
+};
+
+/**
+ * @brief Computes every intermediate value of an operation stream
+ * @param ops Operations in the order they are applied
+ * @param initial Value before the first operation
+ * @param out Destination array; out[i] receives the value after ops[i]
+ * @param mode ScanMode::Exact or ScanMode::Affine
+ * @param threads Worker count, or 0 for std::thread::hardware_concurrency()
+ * @throws std::invalid_argument if @p out is not the size of @p ops, or if
+ *         the stream divides by zero (@p out is then unspecified)
+ */
+void scan(std::span<const Operation> ops, double initial, std::span<double> out,
+          ScanMode mode = ScanMode::Exact, unsigned threads = 0);
+
+/**
+ * @brief Computes every intermediate value of an operation stream
+ * @param ops Operations in the order they are applied
+ * @param initial Value before the first operation
+ * @param mode ScanMode::Exact or ScanMode::Affine
+ * @param threads Worker count, or 0 for std::thread::hardware_concurrency()
+ * @return One value per operation, the value after that operation
+ * @throws std::invalid_argument if the stream divides by zero
+ */
+std::vector<double> scan(std::span<const Operation> ops, double initial,
+                         ScanMode mode = ScanMode::Exact, unsigned threads = 0);
+
+#endif // SCAN_H
@@ -0,0 +1,1466 @@
+/**
+ * @file simd_dispatch.cpp
+ * @brief ISA-specific bulk kernels and the runtime selection between them
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ */
+
+#include "simd_dispatch.h"
+#include "divisor.h"
+#include "double_double.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CALCULATOR_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+using MathUtils::simd::IsaLevel;
+using namespace MathUtils::simd::detail;
+
+namespace {
+    template <Op op>
+    inline double apply(double a, double b) {
+        if constexpr (op == Add) {
+            return a + b;
+        } else if constexpr (op == Subtract) {
+            return a - b;
+        } else if constexpr (op == Multiply) {
+            return a * b;
+        } else {
+            return a / b;
+        }
+    }
+
+    // Portable kernels, also used for the tails of the vector kernels
+
+    template <Op op>
+    void scalarArrayArray(const double* a, const double* b, double* out, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = apply<op>(a[i], b[i]);
+        }
+    }
+
+    template <Op op>
+    void scalarArrayScalar(const double* a, double b, double* out, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = apply<op>(a[i], b);
+        }
+    }
+
+    bool scalarAnyAbsBelow(const double* values, std::size_t n, double threshold) {
+        bool found = false;
+        for (std::size_t i = 0; i < n; ++i) {
+            found |= std::abs(values[i]) < threshold;
+        }
+        return found;
+    }
+
+    void scalarFusedMultiplyAdd(const double* x, double scale, double offset, double* out, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = std::fma(x[i], scale, offset);
+        }
+    }
+
+    // Double-double kernels: the DoubleDouble operators on split hi/lo
+    // arrays. Lane i only touches lane i, so (hi, lo) may alias (b_hi, b_lo).
+
+    template <Op op>
+    inline MathUtils::DoubleDouble applyDoubleDouble(const MathUtils::DoubleDouble& a, const MathUtils::DoubleDouble& b) {
+        if constexpr (op == Add) {
+            return a + b;
+        } else if constexpr (op == Subtract) {
+            return a - b;
+        } else if constexpr (op == Multiply) {
+            return a * b;
+        } else {
+            return a / b;
+        }
+    }
+
+    template <Op op>
+    void scalarDoubleDoubleArrayArray(double* hi, double* lo, const double* b_hi, const double* b_lo, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            MathUtils::DoubleDouble result = applyDoubleDouble<op>({hi[i], lo[i]}, {b_hi[i], b_lo[i]});
+            hi[i] = result.hi();
+            lo[i] = result.lo();
+        }
+    }
+
+    template <Op op>
+    void scalarDoubleDoubleArrayScalar(double* hi, double* lo, double b_hi, double b_lo, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            MathUtils::DoubleDouble result = applyDoubleDouble<op>({hi[i], lo[i]}, {b_hi, b_lo});
+            hi[i] = result.hi();
+            lo[i] = result.lo();
+        }
+    }
+
+    // Checked division works one 64-lane mask word at a time; each ISA
+    // fills the bits of a word from position `bit` onwards.
+
+    std::uint64_t scalarCheckedDivideWord(const double* a, const double* b, double* out, std::size_t n,
+                                          double threshold, std::size_t bit) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < n; ++i, ++bit) {
+            bool failed = std::abs(b[i]) < threshold;
+            out[i] = failed ? a[i] : a[i] / b[i];
+            word |= std::uint64_t(failed) << bit;
+        }
+        return word;
+    }
+
+    template <std::uint64_t (*divideWord)(const double*, const double*, double*, std::size_t, double)>
+    void checkedDivide(const double* a, const double* b, double* out, std::uint64_t* errors, std::size_t n,
+                       double threshold) {
+        for (std::size_t begin = 0; begin < n; begin += 64) {
+            std::size_t count = std::min<std::size_t>(64, n - begin);
+            *errors++ = divideWord(a + begin, b + begin, out + begin, count, threshold);
+        }
+    }
+
+    std::uint64_t scalarDivideWord(const double* a, const double* b, double* out, std::size_t n, double threshold) {
+        return scalarCheckedDivideWord(a, b, out, n, threshold, 0);
+    }
+
+    // Division by a prepared divisor. The correction step needs a fused
+    // multiply-add to be exact, so levels without one divide.
+
+    template <ArrayScalarKernel divide>
+    void divideIgnoringReciprocal(const double* a, double divisor, double, double* out, std::size_t n) {
+        divide(a, divisor, out, n);
+    }
+
+    using ReciprocalRange = MathUtils::detail::ReciprocalRange<double>;
+
+    // Masked kernels read lane i from bit (i % 64) of mask[i / 64]. Vector
+    // widths divide 64, so one vector's bits never straddle two words. The
+    // scalar versions start at lane `i` so they can finish a vector loop.
+
+    inline unsigned maskBits(const std::uint64_t* mask, std::size_t i, unsigned width) {
+        return static_cast<unsigned>(mask[i / 64] >> (i % 64)) & ((1u << width) - 1);
+    }
+
+    template <Op op>
+    void scalarMaskedArrayArrayFrom(std::size_t i, const double* a, const double* b, double* out,
+                                    const std::uint64_t* mask, std::size_t n) {
+        for (; i < n; ++i) {
+            out[i] = maskBits(mask, i, 1) ? apply<op>(a[i], b[i]) : a[i];
+        }
+    }
+
+    template <Op op>
+    void scalarMaskedArrayScalarFrom(std::size_t i, const double* a, double b, double* out,
+                                     const std::uint64_t* mask, std::size_t n) {
+        for (; i < n; ++i) {
+            out[i] = maskBits(mask, i, 1) ? apply<op>(a[i], b) : a[i];
+        }
+    }
+
+    bool scalarMaskedAnyAbsBelowFrom(std::size_t i, const double* values, const std::uint64_t* mask, std::size_t n,
+                                     double threshold) {
+        bool found = false;
+        for (; i < n; ++i) {
+            found |= maskBits(mask, i, 1) && std::abs(values[i]) < threshold;
+        }
+        return found;
+    }
+
+    template <Cmp cmp>
+    inline bool compare(double a, double b) {
+        if constexpr (cmp == Less) {
+            return a < b;
+        } else if constexpr (cmp == LessEqual) {
+            return a <= b;
+        } else if constexpr (cmp == Greater) {
+            return a > b;
+        } else if constexpr (cmp == GreaterEqual) {
+            return a >= b;
+        } else if constexpr (cmp == Equal) {
+            return a == b;
+        } else {
+            return a != b;
+        }
+    }
+
+    template <Cmp cmp>
+    void scalarCompareFrom(std::size_t i, const double* a, double b, std::uint64_t* mask, std::size_t n) {
+        for (; i < n; ++i) {
+            mask[i / 64] |= std::uint64_t(compare<cmp>(a[i], b)) << (i % 64);
+        }
+    }
+
+    template <Op op>
+    void scalarMaskedArrayArray(const double* a, const double* b, double* out, const std::uint64_t* mask,
+                                std::size_t n) {
+        scalarMaskedArrayArrayFrom<op>(0, a, b, out, mask, n);
+    }
+
+    template <Op op>
+    void scalarMaskedArrayScalar(const double* a, double b, double* out, const std::uint64_t* mask, std::size_t n) {
+        scalarMaskedArrayScalarFrom<op>(0, a, b, out, mask, n);
+    }
+
+    bool scalarMaskedAnyAbsBelow(const double* values, const std::uint64_t* mask, std::size_t n, double threshold) {
+        return scalarMaskedAnyAbsBelowFrom(0, values, mask, n, threshold);
+    }
+
+    template <Cmp cmp>
+    void scalarCompare(const double* a, double b, std::uint64_t* mask, std::size_t n) {
+        std::fill(mask, mask + (n + 63) / 64, 0);
+        scalarCompareFrom<cmp>(0, a, b, mask, n);
+    }
+
+    // Integer kernels for the unit columns of DecimalBatch. They compute in
+    // std::uint64_t so that overflow wraps like the vector instructions do
+    // instead of being undefined.
+
+    template <Op op>
+    inline std::int64_t applyInt64(std::int64_t a, std::int64_t b) {
+        const auto x = static_cast<std::uint64_t>(a);
+        const auto y = static_cast<std::uint64_t>(b);
+        return static_cast<std::int64_t>(op == Add ? x + y : x - y);
+    }
+
+    template <Op op>
+    void scalarInt64ArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = applyInt64<op>(a[i], b[i]);
+        }
+    }
+
+    template <Op op>
+    void scalarInt64ArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = applyInt64<op>(a[i], b);
+        }
+    }
+
+    std::int64_t scalarInt64Sum(const std::int64_t* values, std::size_t n) {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum = applyInt64<Add>(sum, values[i]);
+        }
+        return sum;
+    }
+
+    // Overflowing a + b or a - b always goes past the end of the range on
+    // the side of a's sign, so the saturated value is INT64_MAX flipped
+    // to INT64_MIN by a's sign bit. The vector kernels use the same rule.
+
+    template <Op op>
+    inline bool overflowingInt64(std::int64_t a, std::int64_t b, std::int64_t& result) {
+        return op == Add ? __builtin_add_overflow(a, b, &result) : __builtin_sub_overflow(a, b, &result);
+    }
+
+    inline std::int64_t saturatedInt64(std::int64_t a) {
+        return (a >> 63) ^ INT64_MAX;
+    }
+
+    template <Op op>
+    void scalarInt64SaturatingArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            std::int64_t result;
+            a[i] = overflowingInt64<op>(a[i], b[i], result) ? saturatedInt64(a[i]) : result;
+        }
+    }
+
+    template <Op op>
+    void scalarInt64SaturatingArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            std::int64_t result;
+            a[i] = overflowingInt64<op>(a[i], b, result) ? saturatedInt64(a[i]) : result;
+        }
+    }
+
+    // Checked kernels OR the overflow of lane i into bit (i % 64) of
+    // overflow[i / 64]; the scalar versions start at lane `i` so they can
+    // finish a vector loop, like the masked kernels.
+
+    template <Op op>
+    void scalarInt64CheckedArrayArrayFrom(std::size_t i, std::int64_t* a, const std::int64_t* b,
+                                          std::uint64_t* overflow, std::size_t n) {
+        for (; i < n; ++i) {
+            overflow[i / 64] |= std::uint64_t(overflowingInt64<op>(a[i], b[i], a[i])) << (i % 64);
+        }
+    }
+
+    template <Op op>
+    void scalarInt64CheckedArrayScalarFrom(std::size_t i, std::int64_t* a, std::int64_t b, std::uint64_t* overflow,
+                                           std::size_t n) {
+        for (; i < n; ++i) {
+            overflow[i / 64] |= std::uint64_t(overflowingInt64<op>(a[i], b, a[i])) << (i % 64);
+        }
+    }
+
+    template <Op op>
+    void scalarInt64CheckedArrayArray(std::int64_t* a, const std::int64_t* b, std::uint64_t* overflow,
+                                      std::size_t n) {
+        scalarInt64CheckedArrayArrayFrom<op>(0, a, b, overflow, n);
+    }
+
+    template <Op op>
+    void scalarInt64CheckedArrayScalar(std::int64_t* a, std::int64_t b, std::uint64_t* overflow, std::size_t n) {
+        scalarInt64CheckedArrayScalarFrom<op>(0, a, b, overflow, n);
+    }
+
+#ifdef CALCULATOR_SIMD_X86
+
+    // Immediate predicate of _mm256_cmp_pd / _mm512_cmp_pd_mask for a Cmp
+    template <Cmp cmp>
+    constexpr int cmpPredicate() {
+        constexpr int predicates[CmpCount] = {_CMP_LT_OQ, _CMP_LE_OQ, _CMP_GT_OQ,
+                                              _CMP_GE_OQ, _CMP_EQ_OQ, _CMP_NEQ_UQ};
+        return predicates[cmp];
+    }
+
+    // SSE2: 2 lanes. There is no FMA instruction at this level, so the
+    // fused and double-double kernels stay on the scalar std::fma path to
+    // keep results exact. The saturating integer kernels stay scalar too:
+    // without a 64-bit compare the vector select costs more than the
+    // well-predicted overflow branch it replaces.
+
+    template <Op op>
+    __attribute__((target("sse2"))) inline __m128d applySse2(__m128d a, __m128d b) {
+        if constexpr (op == Add) {
+            return _mm_add_pd(a, b);
+        } else if constexpr (op == Subtract) {
+            return _mm_sub_pd(a, b);
+        } else if constexpr (op == Multiply) {
+            return _mm_mul_pd(a, b);
+        } else {
+            return _mm_div_pd(a, b);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2ArrayArray(const double* a, const double* b, double* out, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(out + i, applySse2<op>(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        }
+        scalarArrayArray<op>(a + i, b + i, out + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2ArrayScalar(const double* a, double b, double* out, std::size_t n) {
+        const __m128d vb = _mm_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            _mm_storeu_pd(out + i, applySse2<op>(_mm_loadu_pd(a + i), vb));
+        }
+        scalarArrayScalar<op>(a + i, b, out + i, n - i);
+    }
+
+    __attribute__((target("sse2")))
+    bool sse2AnyAbsBelow(const double* values, std::size_t n, double threshold) {
+        const __m128d sign = _mm_set1_pd(-0.0);
+        const __m128d limit = _mm_set1_pd(threshold);
+        __m128d found = _mm_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d magnitude = _mm_andnot_pd(sign, _mm_loadu_pd(values + i));
+            found = _mm_or_pd(found, _mm_cmplt_pd(magnitude, limit));
+        }
+        return _mm_movemask_pd(found) != 0 || scalarAnyAbsBelow(values + i, n - i, threshold);
+    }
+
+    __attribute__((target("sse2")))
+    std::uint64_t sse2DivideWord(const double* a, const double* b, double* out, std::size_t n, double threshold) {
+        const __m128d sign = _mm_set1_pd(-0.0);
+        const __m128d limit = _mm_set1_pd(threshold);
+        std::uint64_t word = 0;
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d va = _mm_loadu_pd(a + i);
+            __m128d vb = _mm_loadu_pd(b + i);
+            __m128d failed = _mm_cmplt_pd(_mm_andnot_pd(sign, vb), limit);
+            // No blendv before SSE4.1: select with and/andnot/or
+            __m128d q = _mm_or_pd(_mm_and_pd(failed, va), _mm_andnot_pd(failed, _mm_div_pd(va, vb)));
+            _mm_storeu_pd(out + i, q);
+            word |= std::uint64_t(_mm_movemask_pd(failed)) << i;
+        }
+        return word | scalarCheckedDivideWord(a + i, b + i, out + i, n - i, threshold, i);
+    }
+
+    __attribute__((target("sse2"))) inline __m128d laneMaskSse2(unsigned bits) {
+        return _mm_castsi128_pd(_mm_set_epi64x(-static_cast<long long>(bits >> 1), -static_cast<long long>(bits & 1)));
+    }
+
+    __attribute__((target("sse2"))) inline __m128d selectSse2(__m128d mask, __m128d yes, __m128d no) {
+        return _mm_or_pd(_mm_and_pd(mask, yes), _mm_andnot_pd(mask, no));
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2MaskedArrayArray(const double* a, const double* b, double* out, const std::uint64_t* mask,
+                              std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d va = _mm_loadu_pd(a + i);
+            __m128d result = applySse2<op>(va, _mm_loadu_pd(b + i));
+            _mm_storeu_pd(out + i, selectSse2(laneMaskSse2(maskBits(mask, i, 2)), result, va));
+        }
+        scalarMaskedArrayArrayFrom<op>(i, a, b, out, mask, n);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2MaskedArrayScalar(const double* a, double b, double* out, const std::uint64_t* mask, std::size_t n) {
+        const __m128d vb = _mm_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d va = _mm_loadu_pd(a + i);
+            _mm_storeu_pd(out + i, selectSse2(laneMaskSse2(maskBits(mask, i, 2)), applySse2<op>(va, vb), va));
+        }
+        scalarMaskedArrayScalarFrom<op>(i, a, b, out, mask, n);
+    }
+
+    __attribute__((target("sse2")))
+    bool sse2MaskedAnyAbsBelow(const double* values, const std::uint64_t* mask, std::size_t n, double threshold) {
+        const __m128d sign = _mm_set1_pd(-0.0);
+        const __m128d limit = _mm_set1_pd(threshold);
+        unsigned found = 0;
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d magnitude = _mm_andnot_pd(sign, _mm_loadu_pd(values + i));
+            found |= static_cast<unsigned>(_mm_movemask_pd(_mm_cmplt_pd(magnitude, limit))) & maskBits(mask, i, 2);
+        }
+        return found != 0 || scalarMaskedAnyAbsBelowFrom(i, values, mask, n, threshold);
+    }
+
+    template <Cmp cmp>
+    __attribute__((target("sse2"))) inline __m128d compareSse2(__m128d a, __m128d b) {
+        if constexpr (cmp == Less) {
+            return _mm_cmplt_pd(a, b);
+        } else if constexpr (cmp == LessEqual) {
+            return _mm_cmple_pd(a, b);
+        } else if constexpr (cmp == Greater) {
+            return _mm_cmpgt_pd(a, b);
+        } else if constexpr (cmp == GreaterEqual) {
+            return _mm_cmpge_pd(a, b);
+        } else if constexpr (cmp == Equal) {
+            return _mm_cmpeq_pd(a, b);
+        } else {
+            return _mm_cmpneq_pd(a, b);
+        }
+    }
+
+    template <Cmp cmp>
+    __attribute__((target("sse2")))
+    void sse2Compare(const double* a, double b, std::uint64_t* mask, std::size_t n) {
+        std::fill(mask, mask + (n + 63) / 64, 0);
+        const __m128d vb = _mm_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            unsigned bits = static_cast<unsigned>(_mm_movemask_pd(compareSse2<cmp>(_mm_loadu_pd(a + i), vb)));
+            mask[i / 64] |= std::uint64_t(bits) << (i % 64);
+        }
+        scalarCompareFrom<cmp>(i, a, b, mask, n);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2"))) inline __m128i applyInt64Sse2(__m128i a, __m128i b) {
+        return op == Add ? _mm_add_epi64(a, b) : _mm_sub_epi64(a, b);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2Int64ArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), applyInt64Sse2<op>(va, vb));
+        }
+        scalarInt64ArrayArray<op>(a + i, b + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2Int64ArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        const __m128i vb = _mm_set1_epi64x(b);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), applyInt64Sse2<op>(va, vb));
+        }
+        scalarInt64ArrayScalar<op>(a + i, b, n - i);
+    }
+
+    // Wrapped a op b; the sign bit of each lane of `overflow` is set where it wrapped
+    template <Op op>
+    __attribute__((target("sse2"))) inline __m128i overflowingInt64Sse2(__m128i a, __m128i b, __m128i& overflow) {
+        __m128i result = applyInt64Sse2<op>(a, b);
+        if constexpr (op == Add) {
+            overflow = _mm_and_si128(_mm_xor_si128(a, result), _mm_xor_si128(b, result));
+        } else {
+            overflow = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, result));
+        }
+        return result;
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2Int64CheckedArrayArray(std::int64_t* a, const std::int64_t* b, std::uint64_t* overflow, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            __m128i wrapped;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), overflowingInt64Sse2<op>(va, vb, wrapped));
+            overflow[i / 64] |= std::uint64_t(_mm_movemask_pd(_mm_castsi128_pd(wrapped))) << (i % 64);
+        }
+        scalarInt64CheckedArrayArrayFrom<op>(i, a, b, overflow, n);
+    }
+
+    template <Op op>
+    __attribute__((target("sse2")))
+    void sse2Int64CheckedArrayScalar(std::int64_t* a, std::int64_t b, std::uint64_t* overflow, std::size_t n) {
+        const __m128i vb = _mm_set1_epi64x(b);
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i wrapped;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(a + i), overflowingInt64Sse2<op>(va, vb, wrapped));
+            overflow[i / 64] |= std::uint64_t(_mm_movemask_pd(_mm_castsi128_pd(wrapped))) << (i % 64);
+        }
+        scalarInt64CheckedArrayScalarFrom<op>(i, a, b, overflow, n);
+    }
+
+    __attribute__((target("sse2"))) inline std::int64_t horizontalSumSse2(__m128i v) {
+        return _mm_cvtsi128_si64(_mm_add_epi64(v, _mm_unpackhi_epi64(v, v)));
+    }
+
+    __attribute__((target("sse2")))
+    std::int64_t sse2Int64Sum(const std::int64_t* values, std::size_t n) {
+        __m128i sum = _mm_setzero_si128();
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            sum = _mm_add_epi64(sum, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)));
+        }
+        return applyInt64<Add>(horizontalSumSse2(sum), scalarInt64Sum(values + i, n - i));
+    }
+
+    // AVX2: 4 lanes. The double-double helpers follow the DoubleDouble
+    // operators step for step (fma(a, b, -p) is fmsub(a, b, p)), so they
+    // produce the same bits as the scalar kernels. Their scalar tails can
+    // become sibling calls into SSE code, which GCC does not precede with
+    // vzeroupper, so the kernels clear the upper state themselves.
+
+    template <Op op>
+    __attribute__((target("avx2,fma"))) inline __m256d applyAvx2(__m256d a, __m256d b) {
+        if constexpr (op == Add) {
+            return _mm256_add_pd(a, b);
+        } else if constexpr (op == Subtract) {
+            return _mm256_sub_pd(a, b);
+        } else if constexpr (op == Multiply) {
+            return _mm256_mul_pd(a, b);
+        } else {
+            return _mm256_div_pd(a, b);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2ArrayArray(const double* a, const double* b, double* out, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(out + i, applyAvx2<op>(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        }
+        scalarArrayArray<op>(a + i, b + i, out + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2ArrayScalar(const double* a, double b, double* out, std::size_t n) {
+        const __m256d vb = _mm256_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(out + i, applyAvx2<op>(_mm256_loadu_pd(a + i), vb));
+        }
+        scalarArrayScalar<op>(a + i, b, out + i, n - i);
+    }
+
+    __attribute__((target("avx2,fma")))
+    bool avx2AnyAbsBelow(const double* values, std::size_t n, double threshold) {
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d limit = _mm256_set1_pd(threshold);
+        __m256d found = _mm256_setzero_pd();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d magnitude = _mm256_andnot_pd(sign, _mm256_loadu_pd(values + i));
+            found = _mm256_or_pd(found, _mm256_cmp_pd(magnitude, limit, _CMP_LT_OQ));
+        }
+        return _mm256_movemask_pd(found) != 0 || scalarAnyAbsBelow(values + i, n - i, threshold);
+    }
+
+    __attribute__((target("avx2,fma")))
+    std::uint64_t avx2DivideWord(const double* a, const double* b, double* out, std::size_t n, double threshold) {
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d limit = _mm256_set1_pd(threshold);
+        std::uint64_t word = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d va = _mm256_loadu_pd(a + i);
+            __m256d vb = _mm256_loadu_pd(b + i);
+            __m256d failed = _mm256_cmp_pd(_mm256_andnot_pd(sign, vb), limit, _CMP_LT_OQ);
+            _mm256_storeu_pd(out + i, _mm256_blendv_pd(_mm256_div_pd(va, vb), va, failed));
+            word |= std::uint64_t(_mm256_movemask_pd(failed)) << i;
+        }
+        return word | scalarCheckedDivideWord(a + i, b + i, out + i, n - i, threshold, i);
+    }
+
+    // q = a * r is within 1 ulp of a / d, and q + fma(-q, d, a) * r rounds
+    // it correctly (see divisor.h). The range test, min(|a|, |q|) >= low
+    // and |q| <= high, fails for zeros, infinities and NaN too; a vector
+    // with such a lane is divided instead.
+    __attribute__((target("avx2,fma")))
+    void avx2ReciprocalDivide(const double* a, double divisor, double reciprocal, double* out, std::size_t n) {
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d vd = _mm256_set1_pd(divisor);
+        const __m256d vr = _mm256_set1_pd(reciprocal);
+        const __m256d low = _mm256_set1_pd(ReciprocalRange::minOperand);
+        const __m256d high = _mm256_set1_pd(ReciprocalRange::maxQuotient);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d va = _mm256_loadu_pd(a + i);
+            __m256d quotient = _mm256_mul_pd(va, vr);
+            __m256d magnitude = _mm256_andnot_pd(sign, quotient);
+            __m256d smallest = _mm256_min_pd(_mm256_andnot_pd(sign, va), magnitude);
+            __m256d exact = _mm256_and_pd(_mm256_cmp_pd(smallest, low, _CMP_GE_OQ),
+                                          _mm256_cmp_pd(magnitude, high, _CMP_LE_OQ));
+            __m256d result = _mm256_fmadd_pd(_mm256_fnmadd_pd(quotient, vd, va), vr, quotient);
+            if (_mm256_movemask_pd(exact) != 0xF) {
+                result = _mm256_div_pd(va, vd);
+            }
+            _mm256_storeu_pd(out + i, result);
+        }
+        scalarArrayScalar<Divide>(a + i, divisor, out + i, n - i);
+    }
+
+    __attribute__((target("avx2,fma"))) inline __m256d laneMaskAvx2(unsigned bits) {
+        const __m256i select = _mm256_setr_epi64x(1, 2, 4, 8);
+        __m256i lanes = _mm256_and_si256(_mm256_set1_epi64x(bits), select);
+        return _mm256_castsi256_pd(_mm256_cmpeq_epi64(lanes, select));
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2MaskedArrayArray(const double* a, const double* b, double* out, const std::uint64_t* mask,
+                              std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d va = _mm256_loadu_pd(a + i);
+            __m256d result = applyAvx2<op>(va, _mm256_loadu_pd(b + i));
+            _mm256_storeu_pd(out + i, _mm256_blendv_pd(va, result, laneMaskAvx2(maskBits(mask, i, 4))));
+        }
+        scalarMaskedArrayArrayFrom<op>(i, a, b, out, mask, n);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2MaskedArrayScalar(const double* a, double b, double* out, const std::uint64_t* mask, std::size_t n) {
+        const __m256d vb = _mm256_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d va = _mm256_loadu_pd(a + i);
+            _mm256_storeu_pd(out + i, _mm256_blendv_pd(va, applyAvx2<op>(va, vb), laneMaskAvx2(maskBits(mask, i, 4))));
+        }
+        scalarMaskedArrayScalarFrom<op>(i, a, b, out, mask, n);
+    }
+
+    __attribute__((target("avx2,fma")))
+    bool avx2MaskedAnyAbsBelow(const double* values, const std::uint64_t* mask, std::size_t n, double threshold) {
+        const __m256d sign = _mm256_set1_pd(-0.0);
+        const __m256d limit = _mm256_set1_pd(threshold);
+        unsigned found = 0;
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d magnitude = _mm256_andnot_pd(sign, _mm256_loadu_pd(values + i));
+            unsigned below = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(magnitude, limit, _CMP_LT_OQ)));
+            found |= below & maskBits(mask, i, 4);
+        }
+        return found != 0 || scalarMaskedAnyAbsBelowFrom(i, values, mask, n, threshold);
+    }
+
+    template <Cmp cmp>
+    __attribute__((target("avx2,fma")))
+    void avx2Compare(const double* a, double b, std::uint64_t* mask, std::size_t n) {
+        std::fill(mask, mask + (n + 63) / 64, 0);
+        const __m256d vb = _mm256_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d hits = _mm256_cmp_pd(_mm256_loadu_pd(a + i), vb, cmpPredicate<cmp>());
+            mask[i / 64] |= std::uint64_t(_mm256_movemask_pd(hits)) << (i % 64);
+        }
+        scalarCompareFrom<cmp>(i, a, b, mask, n);
+    }
+
+    __attribute__((target("avx2,fma"))) inline __m256d twoSumAvx2(__m256d a, __m256d b, __m256d& e) {
+        __m256d s = _mm256_add_pd(a, b);
+        __m256d b_virtual = _mm256_sub_pd(s, a);
+        e = _mm256_add_pd(_mm256_sub_pd(a, _mm256_sub_pd(s, b_virtual)), _mm256_sub_pd(b, b_virtual));
+        return s;
+    }
+
+    __attribute__((target("avx2,fma"))) inline __m256d fastTwoSumAvx2(__m256d a, __m256d b, __m256d& e) {
+        __m256d s = _mm256_add_pd(a, b);
+        e = _mm256_sub_pd(b, _mm256_sub_pd(s, a));
+        return s;
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma"))) inline void applyDoubleDoubleAvx2(__m256d& hi, __m256d& lo, __m256d b_hi,
+                                                                         __m256d b_lo) {
+        if constexpr (op == Add || op == Subtract) {
+            if constexpr (op == Subtract) {
+                const __m256d sign = _mm256_set1_pd(-0.0);
+                b_hi = _mm256_xor_pd(b_hi, sign);
+                b_lo = _mm256_xor_pd(b_lo, sign);
+            }
+            __m256d e, f;
+            __m256d s = twoSumAvx2(hi, b_hi, e);
+            __m256d t = twoSumAvx2(lo, b_lo, f);
+            s = fastTwoSumAvx2(s, _mm256_add_pd(e, t), e);
+            hi = fastTwoSumAvx2(s, _mm256_add_pd(e, f), lo);
+        } else if constexpr (op == Multiply) {
+            __m256d p = _mm256_mul_pd(hi, b_hi);
+            __m256d e = _mm256_fmsub_pd(hi, b_hi, p);
+            e = _mm256_add_pd(e, _mm256_fmadd_pd(lo, b_hi, _mm256_mul_pd(hi, b_lo)));
+            hi = fastTwoSumAvx2(p, e, lo);
+        } else {
+            __m256d q = _mm256_div_pd(hi, b_hi);
+            __m256d r_hi = _mm256_mul_pd(b_hi, q);
+            __m256d e = _mm256_fmadd_pd(b_lo, q, _mm256_fmsub_pd(b_hi, q, r_hi));
+            r_hi = fastTwoSumAvx2(r_hi, e, e);
+            __m256d remainder = _mm256_add_pd(_mm256_sub_pd(hi, r_hi), _mm256_sub_pd(lo, e));
+            hi = fastTwoSumAvx2(q, _mm256_div_pd(remainder, b_hi), lo);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2DoubleDoubleArrayArray(double* hi, double* lo, const double* b_hi, const double* b_lo, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d vhi = _mm256_loadu_pd(hi + i);
+            __m256d vlo = _mm256_loadu_pd(lo + i);
+            applyDoubleDoubleAvx2<op>(vhi, vlo, _mm256_loadu_pd(b_hi + i), _mm256_loadu_pd(b_lo + i));
+            _mm256_storeu_pd(hi + i, vhi);
+            _mm256_storeu_pd(lo + i, vlo);
+        }
+        _mm256_zeroupper();
+        scalarDoubleDoubleArrayArray<op>(hi + i, lo + i, b_hi + i, b_lo + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2DoubleDoubleArrayScalar(double* hi, double* lo, double b_hi, double b_lo, std::size_t n) {
+        const __m256d vb_hi = _mm256_set1_pd(b_hi);
+        const __m256d vb_lo = _mm256_set1_pd(b_lo);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d vhi = _mm256_loadu_pd(hi + i);
+            __m256d vlo = _mm256_loadu_pd(lo + i);
+            applyDoubleDoubleAvx2<op>(vhi, vlo, vb_hi, vb_lo);
+            _mm256_storeu_pd(hi + i, vhi);
+            _mm256_storeu_pd(lo + i, vlo);
+        }
+        _mm256_zeroupper();
+        scalarDoubleDoubleArrayScalar<op>(hi + i, lo + i, b_hi, b_lo, n - i);
+    }
+
+    __attribute__((target("avx2,fma")))
+    void avx2FusedMultiplyAdd(const double* x, double scale, double offset, double* out, std::size_t n) {
+        const __m256d vscale = _mm256_set1_pd(scale);
+        const __m256d voffset = _mm256_set1_pd(offset);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm256_storeu_pd(out + i, _mm256_fmadd_pd(_mm256_loadu_pd(x + i), vscale, voffset));
+        }
+        scalarFusedMultiplyAdd(x + i, scale, offset, out + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma"))) inline __m256i applyInt64Avx2(__m256i a, __m256i b) {
+        return op == Add ? _mm256_add_epi64(a, b) : _mm256_sub_epi64(a, b);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64ArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), applyInt64Avx2<op>(va, vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64ArrayArray<op>(a + i, b + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64ArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        const __m256i vb = _mm256_set1_epi64x(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), applyInt64Avx2<op>(va, vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64ArrayScalar<op>(a + i, b, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma"))) inline __m256i overflowingInt64Avx2(__m256i a, __m256i b, __m256i& overflow) {
+        __m256i result = applyInt64Avx2<op>(a, b);
+        if constexpr (op == Add) {
+            overflow = _mm256_and_si256(_mm256_xor_si256(a, result), _mm256_xor_si256(b, result));
+        } else {
+            overflow = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, result));
+        }
+        return result;
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma"))) inline __m256i saturatingInt64Avx2(__m256i a, __m256i b) {
+        __m256i overflow;
+        __m256i result = overflowingInt64Avx2<op>(a, b, overflow);
+        __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+        __m256i saturated = _mm256_xor_si256(sign, _mm256_set1_epi64x(INT64_MAX));
+        // blendv_pd selects on the sign bit of each 64-bit lane
+        return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(result), _mm256_castsi256_pd(saturated),
+                                                     _mm256_castsi256_pd(overflow)));
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64SaturatingArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), saturatingInt64Avx2<op>(va, vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64SaturatingArrayArray<op>(a + i, b + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64SaturatingArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        const __m256i vb = _mm256_set1_epi64x(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), saturatingInt64Avx2<op>(va, vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64SaturatingArrayScalar<op>(a + i, b, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64CheckedArrayArray(std::int64_t* a, const std::int64_t* b, std::uint64_t* overflow, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            __m256i wrapped;
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), overflowingInt64Avx2<op>(va, vb, wrapped));
+            overflow[i / 64] |= std::uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(wrapped))) << (i % 64);
+        }
+        _mm256_zeroupper();
+        scalarInt64CheckedArrayArrayFrom<op>(i, a, b, overflow, n);
+    }
+
+    template <Op op>
+    __attribute__((target("avx2,fma")))
+    void avx2Int64CheckedArrayScalar(std::int64_t* a, std::int64_t b, std::uint64_t* overflow, std::size_t n) {
+        const __m256i vb = _mm256_set1_epi64x(b);
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            __m256i wrapped;
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(a + i), overflowingInt64Avx2<op>(va, vb, wrapped));
+            overflow[i / 64] |= std::uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(wrapped))) << (i % 64);
+        }
+        _mm256_zeroupper();
+        scalarInt64CheckedArrayScalarFrom<op>(i, a, b, overflow, n);
+    }
+
+    __attribute__((target("avx2,fma")))
+    std::int64_t avx2Int64Sum(const std::int64_t* values, std::size_t n) {
+        __m256i sum = _mm256_setzero_si256();
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            sum = _mm256_add_epi64(sum, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)));
+        }
+        __m128i half = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        std::int64_t vector_sum = _mm_cvtsi128_si64(_mm_add_epi64(half, _mm_unpackhi_epi64(half, half)));
+        _mm256_zeroupper();
+        return applyInt64<Add>(vector_sum, scalarInt64Sum(values + i, n - i));
+    }
+
+    // AVX-512: 8 lanes
+
+    template <Op op>
+    __attribute__((target("avx512f"))) inline __m512d applyAvx512(__m512d a, __m512d b) {
+        if constexpr (op == Add) {
+            return _mm512_add_pd(a, b);
+        } else if constexpr (op == Subtract) {
+            return _mm512_sub_pd(a, b);
+        } else if constexpr (op == Multiply) {
+            return _mm512_mul_pd(a, b);
+        } else {
+            return _mm512_div_pd(a, b);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512ArrayArray(const double* a, const double* b, double* out, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(out + i, applyAvx512<op>(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+        }
+        scalarArrayArray<op>(a + i, b + i, out + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512ArrayScalar(const double* a, double b, double* out, std::size_t n) {
+        const __m512d vb = _mm512_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(out + i, applyAvx512<op>(_mm512_loadu_pd(a + i), vb));
+        }
+        scalarArrayScalar<op>(a + i, b, out + i, n - i);
+    }
+
+    __attribute__((target("avx512f")))
+    bool avx512AnyAbsBelow(const double* values, std::size_t n, double threshold) {
+        const __m512d limit = _mm512_set1_pd(threshold);
+        __mmask8 found = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            found |= _mm512_cmp_pd_mask(_mm512_abs_pd(_mm512_loadu_pd(values + i)), limit, _CMP_LT_OQ);
+        }
+        return found != 0 || scalarAnyAbsBelow(values + i, n - i, threshold);
+    }
+
+    __attribute__((target("avx512f")))
+    std::uint64_t avx512DivideWord(const double* a, const double* b, double* out, std::size_t n, double threshold) {
+        const __m512d limit = _mm512_set1_pd(threshold);
+        std::uint64_t word = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512d va = _mm512_loadu_pd(a + i);
+            __m512d vb = _mm512_loadu_pd(b + i);
+            __mmask8 failed = _mm512_cmp_pd_mask(_mm512_abs_pd(vb), limit, _CMP_LT_OQ);
+            _mm512_storeu_pd(out + i, _mm512_mask_mov_pd(_mm512_div_pd(va, vb), failed, va));
+            word |= std::uint64_t(failed) << i;
+        }
+        return word | scalarCheckedDivideWord(a + i, b + i, out + i, n - i, threshold, i);
+    }
+
+    __attribute__((target("avx512f")))
+    void avx512ReciprocalDivide(const double* a, double divisor, double reciprocal, double* out, std::size_t n) {
+        const __m512d vd = _mm512_set1_pd(divisor);
+        const __m512d vr = _mm512_set1_pd(reciprocal);
+        const __m512d low = _mm512_set1_pd(ReciprocalRange::minOperand);
+        const __m512d high = _mm512_set1_pd(ReciprocalRange::maxQuotient);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512d va = _mm512_loadu_pd(a + i);
+            __m512d quotient = _mm512_mul_pd(va, vr);
+            __m512d magnitude = _mm512_abs_pd(quotient);
+            __mmask8 exact = _mm512_cmp_pd_mask(_mm512_abs_pd(va), low, _CMP_GE_OQ);
+            exact = _mm512_mask_cmp_pd_mask(exact, magnitude, low, _CMP_GE_OQ);
+            exact = _mm512_mask_cmp_pd_mask(exact, magnitude, high, _CMP_LE_OQ);
+            __m512d result = _mm512_fmadd_pd(_mm512_fnmadd_pd(quotient, vd, va), vr, quotient);
+            if (exact != 0xFF) {
+                result = _mm512_mask_div_pd(result, __mmask8(~exact), va, vd);
+            }
+            _mm512_storeu_pd(out + i, result);
+        }
+        scalarArrayScalar<Divide>(a + i, divisor, out + i, n - i);
+    }
+
+    // Native write masks: unselected lanes are passed through from a
+
+    template <Op op>
+    __attribute__((target("avx512f"))) inline __m512d maskApplyAvx512(__m512d a, __mmask8 k, __m512d b) {
+        if constexpr (op == Add) {
+            return _mm512_mask_add_pd(a, k, a, b);
+        } else if constexpr (op == Subtract) {
+            return _mm512_mask_sub_pd(a, k, a, b);
+        } else if constexpr (op == Multiply) {
+            return _mm512_mask_mul_pd(a, k, a, b);
+        } else {
+            return _mm512_mask_div_pd(a, k, a, b);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512MaskedArrayArray(const double* a, const double* b, double* out, const std::uint64_t* mask,
+                                std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 k = static_cast<__mmask8>(maskBits(mask, i, 8));
+            _mm512_storeu_pd(out + i, maskApplyAvx512<op>(_mm512_loadu_pd(a + i), k, _mm512_loadu_pd(b + i)));
+        }
+        scalarMaskedArrayArrayFrom<op>(i, a, b, out, mask, n);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512MaskedArrayScalar(const double* a, double b, double* out, const std::uint64_t* mask,
+                                 std::size_t n) {
+        const __m512d vb = _mm512_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 k = static_cast<__mmask8>(maskBits(mask, i, 8));
+            _mm512_storeu_pd(out + i, maskApplyAvx512<op>(_mm512_loadu_pd(a + i), k, vb));
+        }
+        scalarMaskedArrayScalarFrom<op>(i, a, b, out, mask, n);
+    }
+
+    __attribute__((target("avx512f")))
+    bool avx512MaskedAnyAbsBelow(const double* values, const std::uint64_t* mask, std::size_t n, double threshold) {
+        const __m512d limit = _mm512_set1_pd(threshold);
+        __mmask8 found = 0;
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 k = static_cast<__mmask8>(maskBits(mask, i, 8));
+            found |= _mm512_mask_cmp_pd_mask(k, _mm512_abs_pd(_mm512_loadu_pd(values + i)), limit, _CMP_LT_OQ);
+        }
+        return found != 0 || scalarMaskedAnyAbsBelowFrom(i, values, mask, n, threshold);
+    }
+
+    template <Cmp cmp>
+    __attribute__((target("avx512f")))
+    void avx512Compare(const double* a, double b, std::uint64_t* mask, std::size_t n) {
+        std::fill(mask, mask + (n + 63) / 64, 0);
+        const __m512d vb = _mm512_set1_pd(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 hits = _mm512_cmp_pd_mask(_mm512_loadu_pd(a + i), vb, cmpPredicate<cmp>());
+            mask[i / 64] |= std::uint64_t(hits) << (i % 64);
+        }
+        scalarCompareFrom<cmp>(i, a, b, mask, n);
+    }
+
+    __attribute__((target("avx512f")))
+    void avx512FusedMultiplyAdd(const double* x, double scale, double offset, double* out, std::size_t n) {
+        const __m512d vscale = _mm512_set1_pd(scale);
+        const __m512d voffset = _mm512_set1_pd(offset);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_pd(out + i, _mm512_fmadd_pd(_mm512_loadu_pd(x + i), vscale, voffset));
+        }
+        scalarFusedMultiplyAdd(x + i, scale, offset, out + i, n - i);
+    }
+
+    // AVX-512F includes FMA; same steps as the AVX2 double-double helpers
+
+    __attribute__((target("avx512f"))) inline __m512d twoSumAvx512(__m512d a, __m512d b, __m512d& e) {
+        __m512d s = _mm512_add_pd(a, b);
+        __m512d b_virtual = _mm512_sub_pd(s, a);
+        e = _mm512_add_pd(_mm512_sub_pd(a, _mm512_sub_pd(s, b_virtual)), _mm512_sub_pd(b, b_virtual));
+        return s;
+    }
+
+    __attribute__((target("avx512f"))) inline __m512d fastTwoSumAvx512(__m512d a, __m512d b, __m512d& e) {
+        __m512d s = _mm512_add_pd(a, b);
+        e = _mm512_sub_pd(b, _mm512_sub_pd(s, a));
+        return s;
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f"))) inline void applyDoubleDoubleAvx512(__m512d& hi, __m512d& lo, __m512d b_hi,
+                                                                          __m512d b_lo) {
+        if constexpr (op == Add || op == Subtract) {
+            if constexpr (op == Subtract) {
+                // _mm512_xor_pd needs AVX512DQ; flip the sign bit as integers
+                const __m512i sign = _mm512_set1_epi64(std::int64_t(1) << 63);
+                b_hi = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(b_hi), sign));
+                b_lo = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(b_lo), sign));
+            }
+            __m512d e, f;
+            __m512d s = twoSumAvx512(hi, b_hi, e);
+            __m512d t = twoSumAvx512(lo, b_lo, f);
+            s = fastTwoSumAvx512(s, _mm512_add_pd(e, t), e);
+            hi = fastTwoSumAvx512(s, _mm512_add_pd(e, f), lo);
+        } else if constexpr (op == Multiply) {
+            __m512d p = _mm512_mul_pd(hi, b_hi);
+            __m512d e = _mm512_fmsub_pd(hi, b_hi, p);
+            e = _mm512_add_pd(e, _mm512_fmadd_pd(lo, b_hi, _mm512_mul_pd(hi, b_lo)));
+            hi = fastTwoSumAvx512(p, e, lo);
+        } else {
+            __m512d q = _mm512_div_pd(hi, b_hi);
+            __m512d r_hi = _mm512_mul_pd(b_hi, q);
+            __m512d e = _mm512_fmadd_pd(b_lo, q, _mm512_fmsub_pd(b_hi, q, r_hi));
+            r_hi = fastTwoSumAvx512(r_hi, e, e);
+            __m512d remainder = _mm512_add_pd(_mm512_sub_pd(hi, r_hi), _mm512_sub_pd(lo, e));
+            hi = fastTwoSumAvx512(q, _mm512_div_pd(remainder, b_hi), lo);
+        }
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512DoubleDoubleArrayArray(double* hi, double* lo, const double* b_hi, const double* b_lo, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512d vhi = _mm512_loadu_pd(hi + i);
+            __m512d vlo = _mm512_loadu_pd(lo + i);
+            applyDoubleDoubleAvx512<op>(vhi, vlo, _mm512_loadu_pd(b_hi + i), _mm512_loadu_pd(b_lo + i));
+            _mm512_storeu_pd(hi + i, vhi);
+            _mm512_storeu_pd(lo + i, vlo);
+        }
+        _mm256_zeroupper();
+        scalarDoubleDoubleArrayArray<op>(hi + i, lo + i, b_hi + i, b_lo + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512DoubleDoubleArrayScalar(double* hi, double* lo, double b_hi, double b_lo, std::size_t n) {
+        const __m512d vb_hi = _mm512_set1_pd(b_hi);
+        const __m512d vb_lo = _mm512_set1_pd(b_lo);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512d vhi = _mm512_loadu_pd(hi + i);
+            __m512d vlo = _mm512_loadu_pd(lo + i);
+            applyDoubleDoubleAvx512<op>(vhi, vlo, vb_hi, vb_lo);
+            _mm512_storeu_pd(hi + i, vhi);
+            _mm512_storeu_pd(lo + i, vlo);
+        }
+        _mm256_zeroupper();
+        scalarDoubleDoubleArrayScalar<op>(hi + i, lo + i, b_hi, b_lo, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f"))) inline __m512i applyInt64Avx512(__m512i a, __m512i b) {
+        return op == Add ? _mm512_add_epi64(a, b) : _mm512_sub_epi64(a, b);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64ArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512i va = _mm512_loadu_si512(a + i);
+            _mm512_storeu_si512(a + i, applyInt64Avx512<op>(va, _mm512_loadu_si512(b + i)));
+        }
+        _mm256_zeroupper();
+        scalarInt64ArrayArray<op>(a + i, b + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64ArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        const __m512i vb = _mm512_set1_epi64(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_si512(a + i, applyInt64Avx512<op>(_mm512_loadu_si512(a + i), vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64ArrayScalar<op>(a + i, b, n - i);
+    }
+
+    // Overflowed lanes as a write mask
+    template <Op op>
+    __attribute__((target("avx512f"))) inline __m512i overflowingInt64Avx512(__m512i a, __m512i b,
+                                                                            __mmask8& overflow) {
+        __m512i result = applyInt64Avx512<op>(a, b);
+        __m512i sign;
+        if constexpr (op == Add) {
+            sign = _mm512_and_si512(_mm512_xor_si512(a, result), _mm512_xor_si512(b, result));
+        } else {
+            sign = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, result));
+        }
+        overflow = _mm512_cmplt_epi64_mask(sign, _mm512_setzero_si512());
+        return result;
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f"))) inline __m512i saturatingInt64Avx512(__m512i a, __m512i b) {
+        __mmask8 overflow;
+        __m512i result = overflowingInt64Avx512<op>(a, b, overflow);
+        __mmask8 negative = _mm512_cmplt_epi64_mask(a, _mm512_setzero_si512());
+        __m512i saturated = _mm512_mask_blend_epi64(negative, _mm512_set1_epi64(INT64_MAX),
+                                                    _mm512_set1_epi64(INT64_MIN));
+        return _mm512_mask_blend_epi64(overflow, result, saturated);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64SaturatingArrayArray(std::int64_t* a, const std::int64_t* b, std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m512i va = _mm512_loadu_si512(a + i);
+            _mm512_storeu_si512(a + i, saturatingInt64Avx512<op>(va, _mm512_loadu_si512(b + i)));
+        }
+        _mm256_zeroupper();
+        scalarInt64SaturatingArrayArray<op>(a + i, b + i, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64SaturatingArrayScalar(std::int64_t* a, std::int64_t b, std::size_t n) {
+        const __m512i vb = _mm512_set1_epi64(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm512_storeu_si512(a + i, saturatingInt64Avx512<op>(_mm512_loadu_si512(a + i), vb));
+        }
+        _mm256_zeroupper();
+        scalarInt64SaturatingArrayScalar<op>(a + i, b, n - i);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64CheckedArrayArray(std::int64_t* a, const std::int64_t* b, std::uint64_t* overflow,
+                                      std::size_t n) {
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 wrapped;
+            __m512i va = _mm512_loadu_si512(a + i);
+            _mm512_storeu_si512(a + i, overflowingInt64Avx512<op>(va, _mm512_loadu_si512(b + i), wrapped));
+            overflow[i / 64] |= std::uint64_t(wrapped) << (i % 64);
+        }
+        _mm256_zeroupper();
+        scalarInt64CheckedArrayArrayFrom<op>(i, a, b, overflow, n);
+    }
+
+    template <Op op>
+    __attribute__((target("avx512f")))
+    void avx512Int64CheckedArrayScalar(std::int64_t* a, std::int64_t b, std::uint64_t* overflow, std::size_t n) {
+        const __m512i vb = _mm512_set1_epi64(b);
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __mmask8 wrapped;
+            _mm512_storeu_si512(a + i, overflowingInt64Avx512<op>(_mm512_loadu_si512(a + i), vb, wrapped));
+            overflow[i / 64] |= std::uint64_t(wrapped) << (i % 64);
+        }
+        _mm256_zeroupper();
+        scalarInt64CheckedArrayScalarFrom<op>(i, a, b, overflow, n);
+    }
+
+    __attribute__((target("avx512f")))
+    std::int64_t avx512Int64Sum(const std::int64_t* values, std::size_t n) {
+        __m512i sum = _mm512_setzero_si512();
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            sum = _mm512_add_epi64(sum, _mm512_loadu_si512(values + i));
+        }
+        alignas(64) std::int64_t lanes[8];
+        _mm512_store_si512(lanes, sum);
+        _mm256_zeroupper();
+        std::int64_t vector_sum = scalarInt64Sum(lanes, 8);
+        return applyInt64<Add>(vector_sum, scalarInt64Sum(values + i, n - i));
+    }
+
+#endif // CALCULATOR_SIMD_X86
+
+    BulkKernels makeKernels(IsaLevel level) {
+        switch (level) {
+#ifdef CALCULATOR_SIMD_X86
+        case IsaLevel::AVX512:
+            return {level,
+                    {avx512ArrayArray<Add>, avx512ArrayArray<Subtract>,
+                     avx512ArrayArray<Multiply>, avx512ArrayArray<Divide>},
+                    {avx512ArrayScalar<Add>, avx512ArrayScalar<Subtract>,
+                     avx512ArrayScalar<Multiply>, avx512ArrayScalar<Divide>},
+                    avx512AnyAbsBelow,
+                    avx512FusedMultiplyAdd,
+                    checkedDivide<avx512DivideWord>,
+                    avx512ReciprocalDivide,
+                    {avx512MaskedArrayArray<Add>, avx512MaskedArrayArray<Subtract>,
+                     avx512MaskedArrayArray<Multiply>, avx512MaskedArrayArray<Divide>},
+                    {avx512MaskedArrayScalar<Add>, avx512MaskedArrayScalar<Subtract>,
+                     avx512MaskedArrayScalar<Multiply>, avx512MaskedArrayScalar<Divide>},
+                    avx512MaskedAnyAbsBelow,
+                    {avx512Compare<Less>, avx512Compare<LessEqual>, avx512Compare<Greater>,
+                     avx512Compare<GreaterEqual>, avx512Compare<Equal>, avx512Compare<NotEqual>},
+                    {avx512DoubleDoubleArrayArray<Add>, avx512DoubleDoubleArrayArray<Subtract>,
+                     avx512DoubleDoubleArrayArray<Multiply>, avx512DoubleDoubleArrayArray<Divide>},
+                    {avx512DoubleDoubleArrayScalar<Add>, avx512DoubleDoubleArrayScalar<Subtract>,
+                     avx512DoubleDoubleArrayScalar<Multiply>, avx512DoubleDoubleArrayScalar<Divide>},
+                    {avx512Int64ArrayArray<Add>, avx512Int64ArrayArray<Subtract>},
+                    {avx512Int64ArrayScalar<Add>, avx512Int64ArrayScalar<Subtract>},
+                    avx512Int64Sum,
+                    {avx512Int64SaturatingArrayArray<Add>, avx512Int64SaturatingArrayArray<Subtract>},
+                    {avx512Int64SaturatingArrayScalar<Add>, avx512Int64SaturatingArrayScalar<Subtract>},
+                    {avx512Int64CheckedArrayArray<Add>, avx512Int64CheckedArrayArray<Subtract>},
+                    {avx512Int64CheckedArrayScalar<Add>, avx512Int64CheckedArrayScalar<Subtract>}};
+        case IsaLevel::AVX2:
+            return {level,
+                    {avx2ArrayArray<Add>, avx2ArrayArray<Subtract>,
+                     avx2ArrayArray<Multiply>, avx2ArrayArray<Divide>},
+                    {avx2ArrayScalar<Add>, avx2ArrayScalar<Subtract>,
+                     avx2ArrayScalar<Multiply>, avx2ArrayScalar<Divide>},
+                    avx2AnyAbsBelow,
+                    avx2FusedMultiplyAdd,
+                    checkedDivide<avx2DivideWord>,
+                    avx2ReciprocalDivide,
+                    {avx2MaskedArrayArray<Add>, avx2MaskedArrayArray<Subtract>,
+                     avx2MaskedArrayArray<Multiply>, avx2MaskedArrayArray<Divide>},
+                    {avx2MaskedArrayScalar<Add>, avx2MaskedArrayScalar<Subtract>,
+                     avx2MaskedArrayScalar<Multiply>, avx2MaskedArrayScalar<Divide>},
+                    avx2MaskedAnyAbsBelow,
+                    {avx2Compare<Less>, avx2Compare<LessEqual>, avx2Compare<Greater>,
+                     avx2Compare<GreaterEqual>, avx2Compare<Equal>, avx2Compare<NotEqual>},
+                    {avx2DoubleDoubleArrayArray<Add>, avx2DoubleDoubleArrayArray<Subtract>,
+                     avx2DoubleDoubleArrayArray<Multiply>, avx2DoubleDoubleArrayArray<Divide>},
+                    {avx2DoubleDoubleArrayScalar<Add>, avx2DoubleDoubleArrayScalar<Subtract>,
+                     avx2DoubleDoubleArrayScalar<Multiply>, avx2DoubleDoubleArrayScalar<Divide>},
+                    {avx2Int64ArrayArray<Add>, avx2Int64ArrayArray<Subtract>},
+                    {avx2Int64ArrayScalar<Add>, avx2Int64ArrayScalar<Subtract>},
+                    avx2Int64Sum,
+                    {avx2Int64SaturatingArrayArray<Add>, avx2Int64SaturatingArrayArray<Subtract>},
+                    {avx2Int64SaturatingArrayScalar<Add>, avx2Int64SaturatingArrayScalar<Subtract>},
+                    {avx2Int64CheckedArrayArray<Add>, avx2Int64CheckedArrayArray<Subtract>},
+                    {avx2Int64CheckedArrayScalar<Add>, avx2Int64CheckedArrayScalar<Subtract>}};
+        case IsaLevel::SSE2:
+            return {level,
+                    {sse2ArrayArray<Add>, sse2ArrayArray<Subtract>,
+                     sse2ArrayArray<Multiply>, sse2ArrayArray<Divide>},
+                    {sse2ArrayScalar<Add>, sse2ArrayScalar<Subtract>,
+                     sse2ArrayScalar<Multiply>, sse2ArrayScalar<Divide>},
+                    sse2AnyAbsBelow,
+                    scalarFusedMultiplyAdd,
+                    checkedDivide<sse2DivideWord>,
+                    divideIgnoringReciprocal<sse2ArrayScalar<Divide>>,
+                    {sse2MaskedArrayArray<Add>, sse2MaskedArrayArray<Subtract>,
+                     sse2MaskedArrayArray<Multiply>, sse2MaskedArrayArray<Divide>},
+                    {sse2MaskedArrayScalar<Add>, sse2MaskedArrayScalar<Subtract>,
+                     sse2MaskedArrayScalar<Multiply>, sse2MaskedArrayScalar<Divide>},
+                    sse2MaskedAnyAbsBelow,
+                    {sse2Compare<Less>, sse2Compare<LessEqual>, sse2Compare<Greater>,
+                     sse2Compare<GreaterEqual>, sse2Compare<Equal>, sse2Compare<NotEqual>},
+                    {scalarDoubleDoubleArrayArray<Add>, scalarDoubleDoubleArrayArray<Subtract>,
+                     scalarDoubleDoubleArrayArray<Multiply>, scalarDoubleDoubleArrayArray<Divide>},
+                    {scalarDoubleDoubleArrayScalar<Add>, scalarDoubleDoubleArrayScalar<Subtract>,
+                     scalarDoubleDoubleArrayScalar<Multiply>, scalarDoubleDoubleArrayScalar<Divide>},
+                    {sse2Int64ArrayArray<Add>, sse2Int64ArrayArray<Subtract>},
+                    {sse2Int64ArrayScalar<Add>, sse2Int64ArrayScalar<Subtract>},
+                    sse2Int64Sum,
+                    {scalarInt64SaturatingArrayArray<Add>, scalarInt64SaturatingArrayArray<Subtract>},
+                    {scalarInt64SaturatingArrayScalar<Add>, scalarInt64SaturatingArrayScalar<Subtract>},
+                    {sse2Int64CheckedArrayArray<Add>, sse2Int64CheckedArrayArray<Subtract>},
+                    {sse2Int64CheckedArrayScalar<Add>, sse2Int64CheckedArrayScalar<Subtract>}};
+#endif
+        default:
+            return {IsaLevel::Scalar,
+                    {scalarArrayArray<Add>, scalarArrayArray<Subtract>,
+                     scalarArrayArray<Multiply>, scalarArrayArray<Divide>},
+                    {scalarArrayScalar<Add>, scalarArrayScalar<Subtract>,
+                     scalarArrayScalar<Multiply>, scalarArrayScalar<Divide>},
+                    scalarAnyAbsBelow,
+                    scalarFusedMultiplyAdd,
+                    checkedDivide<scalarDivideWord>,
+                    divideIgnoringReciprocal<scalarArrayScalar<Divide>>,
+                    {scalarMaskedArrayArray<Add>, scalarMaskedArrayArray<Subtract>,
+                     scalarMaskedArrayArray<Multiply>, scalarMaskedArrayArray<Divide>},
+                    {scalarMaskedArrayScalar<Add>, scalarMaskedArrayScalar<Subtract>,
+                     scalarMaskedArrayScalar<Multiply>, scalarMaskedArrayScalar<Divide>},
+                    scalarMaskedAnyAbsBelow,
+                    {scalarCompare<Less>, scalarCompare<LessEqual>, scalarCompare<Greater>,
+                     scalarCompare<GreaterEqual>, scalarCompare<Equal>, scalarCompare<NotEqual>},
+                    {scalarDoubleDoubleArrayArray<Add>, scalarDoubleDoubleArrayArray<Subtract>,
+                     scalarDoubleDoubleArrayArray<Multiply>, scalarDoubleDoubleArrayArray<Divide>},
+                    {scalarDoubleDoubleArrayScalar<Add>, scalarDoubleDoubleArrayScalar<Subtract>,
+                     scalarDoubleDoubleArrayScalar<Multiply>, scalarDoubleDoubleArrayScalar<Divide>},
+                    {scalarInt64ArrayArray<Add>, scalarInt64ArrayArray<Subtract>},
+                    {scalarInt64ArrayScalar<Add>, scalarInt64ArrayScalar<Subtract>},
+                    scalarInt64Sum,
+                    {scalarInt64SaturatingArrayArray<Add>, scalarInt64SaturatingArrayArray<Subtract>},
+                    {scalarInt64SaturatingArrayScalar<Add>, scalarInt64SaturatingArrayScalar<Subtract>},
+                    {scalarInt64CheckedArrayArray<Add>, scalarInt64CheckedArrayArray<Subtract>},
+                    {scalarInt64CheckedArrayScalar<Add>, scalarInt64CheckedArrayScalar<Subtract>}};
+        }
+    }
+
+    IsaLevel detect() {
+#ifdef CALCULATOR_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return IsaLevel::AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return IsaLevel::AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return IsaLevel::SSE2;
+        }
+#endif
+        return IsaLevel::Scalar;
+    }
+
+    IsaLevel selectLevel() {
+        IsaLevel level = MathUtils::simd::detectedLevel();
+        const char* forced = std::getenv("CALCULATOR_SIMD");
+        if (forced == nullptr) {
+            return level;
+        }
+        for (IsaLevel candidate : {IsaLevel::Scalar, IsaLevel::SSE2, IsaLevel::AVX2, IsaLevel::AVX512}) {
+            if (std::strcmp(forced, MathUtils::simd::toString(candidate)) == 0) {
+                // Never select kernels the CPU cannot execute
+                return candidate < level ? candidate : level;
+            }
+        }
+        return level;
+    }
+}
+
+namespace MathUtils {
+namespace simd {
+    IsaLevel detectedLevel() {
+        static const IsaLevel level = detect();
+        return level;
+    }
+
+    IsaLevel activeLevel() {
+        static const IsaLevel level = selectLevel();
+        return level;
+    }
+
+    const char* toString(IsaLevel level) {
+        switch (level) {
+        case IsaLevel::SSE2:
+            return "sse2";
+        case IsaLevel::AVX2:
+            return "avx2";
+        case IsaLevel::AVX512:
+            return "avx512";
+        default:
+            return "scalar";
+        }
+    }
+
+    namespace detail {
+        const BulkKernels& bulkKernels() {
+            static const BulkKernels kernels = makeKernels(activeLevel());
+            return kernels;
+        }
+
+        const BulkKernels& bulkKernels(IsaLevel level) {
+            static const BulkKernels kernels[] = {makeKernels(IsaLevel::Scalar), makeKernels(IsaLevel::SSE2),
+                                                  makeKernels(IsaLevel::AVX2), makeKernels(IsaLevel::AVX512)};
+            // Never hand out kernels the CPU cannot execute
+            return kernels[static_cast<int>(level < detectedLevel() ? level : detectedLevel())];
+        }
+    }
+}
+}
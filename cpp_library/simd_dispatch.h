@@ -0,0 +1,143 @@
+/**
+ * @file simd_dispatch.h
+ * @brief Runtime CPU feature detection for the MathUtils bulk kernels
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * The span overloads in MathUtils run through a table of ISA-specific
+ * kernels. The table is selected once, on first use, from the features
+ * reported by cpuid and is then reached through cached function pointers,
+ * so one binary runs at full width on every machine of a mixed fleet.
+ *
+ * Setting the environment variable `CALCULATOR_SIMD` to `scalar`, `sse2`,
+ * `avx2` or `avx512` before the first bulk call forces a specific level,
+ * which is useful when debugging or comparing kernels. A request above what
+ * the CPU supports is clamped to the detected level.
+ *
+ * @example
+ * ```cpp
+ * std::cout << MathUtils::simd::toString(MathUtils::simd::activeLevel());
+ * // e.g. "avx2"
+ * ```
+ */
+
+#ifndef SIMD_DISPATCH_H
+#define SIMD_DISPATCH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MathUtils {
+namespace simd {
+    /**
+     * @brief Instruction set levels a bulk kernel can be compiled for
+     *
+     * Levels are ordered: every level implies support for the ones below it.
+     */
+    enum class IsaLevel {
+        Scalar, ///< Portable C++ loops, no explicit vector instructions
+        SSE2,   ///< 128-bit vectors (baseline on x86-64)
+        AVX2,   ///< 256-bit vectors with FMA (Haswell and later)
+        AVX512  ///< 512-bit vectors (AVX-512F)
+    };
+
+    /**
+     * @brief Highest level supported by the running CPU
+     * @return Level detected through cpuid, ignoring any override
+     */
+    IsaLevel detectedLevel();
+
+    /**
+     * @brief Level used by the bulk kernels in this process
+     * @return Detected level, or the `CALCULATOR_SIMD` override if set
+     *
+     * The level is chosen on the first call and does not change afterwards.
+     */
+    IsaLevel activeLevel();
+
+    /**
+     * @brief Lower-case name of a level, as accepted by `CALCULATOR_SIMD`
+     * @param level Level to name
+     * @return Static string such as "avx2"
+     */
+    const char* toString(IsaLevel level);
+
+    /// @cond INTERNAL
+    namespace detail {
+        /// Arithmetic operation implemented by a kernel slot.
+        enum Op { Add, Subtract, Multiply, Divide, OpCount };
+
+        /// Ordered comparison implemented by a kernel slot; NotEqual is true for NaN.
+        enum Cmp { Less, LessEqual, Greater, GreaterEqual, Equal, NotEqual, CmpCount };
+
+        using ArrayArrayKernel = void (*)(const double* a, const double* b, double* out, std::size_t n);
+        using ArrayScalarKernel = void (*)(const double* a, double b, double* out, std::size_t n);
+        using AnyBelowKernel = bool (*)(const double* values, std::size_t n, double threshold);
+        using FmaKernel = void (*)(const double* x, double scale, double offset, double* out, std::size_t n);
+        using ReciprocalDivideKernel = void (*)(const double* a, double divisor, double reciprocal, double* out,
+                                                std::size_t n);
+        using CheckedDivideKernel = void (*)(const double* a, const double* b, double* out, std::uint64_t* errors,
+                                             std::size_t n, double threshold);
+        using MaskedArrayArrayKernel = void (*)(const double* a, const double* b, double* out,
+                                                const std::uint64_t* mask, std::size_t n);
+        using MaskedArrayScalarKernel = void (*)(const double* a, double b, double* out,
+                                                 const std::uint64_t* mask, std::size_t n);
+        using MaskedAnyBelowKernel = bool (*)(const double* values, const std::uint64_t* mask, std::size_t n,
+                                              double threshold);
+        using CompareKernel = void (*)(const double* a, double b, std::uint64_t* mask, std::size_t n);
+        using DoubleDoubleArrayArrayKernel = void (*)(double* hi, double* lo, const double* b_hi, const double* b_lo,
+                                                      std::size_t n);
+        using DoubleDoubleArrayScalarKernel = void (*)(double* hi, double* lo, double b_hi, double b_lo,
+                                                       std::size_t n);
+        using Int64ArrayArrayKernel = void (*)(std::int64_t* a, const std::int64_t* b, std::size_t n);
+        using Int64ArrayScalarKernel = void (*)(std::int64_t* a, std::int64_t b, std::size_t n);
+        using Int64SumKernel = std::int64_t (*)(const std::int64_t* values, std::size_t n);
+        using Int64CheckedArrayArrayKernel = void (*)(std::int64_t* a, const std::int64_t* b, std::uint64_t* overflow,
+                                                      std::size_t n);
+        using Int64CheckedArrayScalarKernel = void (*)(std::int64_t* a, std::int64_t b, std::uint64_t* overflow,
+                                                       std::size_t n);
+
+        /// Kernels for one ISA level, indexed by Op.
+        struct BulkKernels {
+            IsaLevel level;
+            ArrayArrayKernel arrayArray[OpCount];
+            ArrayScalarKernel arrayScalar[OpCount];
+            AnyBelowKernel anyAbsBelow; ///< True if any |values[i]| < threshold
+            FmaKernel fusedMultiplyAdd; ///< out[i] = fma(x[i], scale, offset), one rounding
+            /// out[i] = a[i] / b[i], or a[i] with bit i of errors set where |b[i]| < threshold
+            CheckedDivideKernel checkedDivide;
+            /// out[i] = a[i] / divisor, as a[i] * reciprocal plus an FMA correction where that is exact
+            ReciprocalDivideKernel reciprocalDivide;
+            /// out[i] = a[i] op b[i] where bit i of mask is set, a[i] elsewhere
+            MaskedArrayArrayKernel maskedArrayArray[OpCount];
+            MaskedArrayScalarKernel maskedArrayScalar[OpCount];
+            MaskedAnyBelowKernel maskedAnyAbsBelow; ///< True if any selected |values[i]| < threshold
+            CompareKernel compareScalar[CmpCount];  ///< Bit i of mask = a[i] cmp b, indexed by Cmp
+            /// (hi[i], lo[i]) = (hi[i], lo[i]) op (b_hi[i], b_lo[i]) in DoubleDouble arithmetic
+            DoubleDoubleArrayArrayKernel doubleDoubleArrayArray[OpCount];
+            DoubleDoubleArrayScalarKernel doubleDoubleArrayScalar[OpCount];
+            /// a[i] = a[i] op b[i] in 64-bit integers wrapping on overflow; Add and Subtract only
+            Int64ArrayArrayKernel int64ArrayArray[Multiply];
+            Int64ArrayScalarKernel int64ArrayScalar[Multiply];
+            Int64SumKernel int64Sum; ///< Sum of values modulo 2^64, the same at every level
+            /// a[i] = a[i] op b[i] clamped to [INT64_MIN, INT64_MAX]; Add and Subtract only
+            Int64ArrayArrayKernel int64SaturatingArrayArray[Multiply];
+            Int64ArrayScalarKernel int64SaturatingArrayScalar[Multiply];
+            /// a[i] = a[i] op b[i] wrapping, and bit i of overflow set where it wrapped (never
+            /// cleared); Add and Subtract only
+            Int64CheckedArrayArrayKernel int64CheckedArrayArray[Multiply];
+            Int64CheckedArrayScalarKernel int64CheckedArrayScalar[Multiply];
+        };
+
+        /// Table for activeLevel(), built on first use.
+        const BulkKernels& bulkKernels();
+
+        /// Table for @p level clamped to detectedLevel(), so tests can compare every level in one process.
+        const BulkKernels& bulkKernels(IsaLevel level);
+    }
+    /// @endcond
+}
+}
+
+#endif // SIMD_DISPATCH_H
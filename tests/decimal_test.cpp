@@ -0,0 +1,228 @@
+/**
+ * @file decimal_test.cpp
+ * @brief Checks BasicDecimal, DecimalCalculator and DecimalBatch
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Multiplication and division of random operands are compared, in every
+ * rounding mode, with a reference that rounds the exact 128-bit result
+ * on its own. Literal parsing is checked on the edges of the range,
+ * where the digits of a literal that does not fit must be rejected
+ * rather than wrapped. DecimalBatch is compared lane by lane with the
+ * scalar operators; tests/run_tests.sh runs it at every SIMD level.
+ */
+
+#include "decimal.h"
+#include "decimal_batch.h"
+#include "decimal_calculator.h"
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using namespace MathUtils;
+    using Money = Decimal64<2>;
+    using Int128 = MathUtils::detail::Int128;
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+    template <typename Exception, typename Function>
+    bool throws(Function function) {
+        try {
+            function();
+        } catch (const Exception&) {
+            return true;
+        }
+        return false;
+    }
+
+    static_assert((Money("19.99") * 3 - Money("0.97")).units() == 5900);
+    static_assert((Money(59) / 7).units() == 843);
+    static_assert((Money(100) / 3).units() == 3333);
+    static_assert(Money("0.125").units() == 12 && Money("0.135").units() == 14 && Money("-0.125").units() == -12);
+    static_assert(Money(5).rescaled<0>().units() == 5 && Money("2.5").rescaled<0>().units() == 2);
+
+    // n / d rounded to an integer the way Mode says, from the quotient and
+    // remainder of the exact division
+    template <RoundingMode Mode>
+    Int128 reference(Int128 n, Int128 d) {
+        const bool negative = (n < 0) != (d < 0);
+        const Int128 a = n < 0 ? -n : n;
+        const Int128 b = d < 0 ? -d : d;
+        Int128 quotient = a / b;
+        const Int128 remainder = a % b;
+        bool away = false;
+        if (remainder != 0) {
+            const Int128 rest = b - remainder;
+            switch (Mode) {
+            case RoundingMode::HalfEven:
+                away = remainder > rest || (remainder == rest && (quotient & 1) != 0);
+                break;
+            case RoundingMode::HalfAwayFromZero:
+                away = remainder >= rest;
+                break;
+            case RoundingMode::TowardZero:
+                break;
+            case RoundingMode::Floor:
+                away = negative;
+                break;
+            case RoundingMode::Ceiling:
+                away = !negative;
+                break;
+            }
+        }
+        quotient += away;
+        return negative ? -quotient : quotient;
+    }
+
+    template <typename Decimal>
+    bool fits(Int128 units) {
+        // Operands are 64-bit, so results of a Decimal128 always fit
+        return sizeof(Decimal) > 8 || (units >= INT64_MIN && units <= INT64_MAX);
+    }
+
+    // Random units of a random width, with the ties and exact multiples
+    // rounding cares about mixed in
+    std::int64_t pick(std::mt19937_64& rng) {
+        switch (rng() % 5) {
+        case 0:
+            return static_cast<std::int64_t>(rng() % 2000) - 1000;
+        case 1:
+            return (rng() % 2 ? 5 : -5) * static_cast<std::int64_t>(rng() % 1000);
+        default:
+            return static_cast<std::int64_t>(rng() >> (rng() % 64 + 1)) * (rng() % 2 ? 1 : -1);
+        }
+    }
+
+    template <typename Decimal>
+    void checkArithmetic(const char* what) {
+        constexpr RoundingMode mode = Decimal::rounding;
+        const Int128 one = static_cast<Int128>(Decimal::unitsPerOne);
+        std::mt19937_64 rng(22);
+        bool agree = true;
+        for (int i = 0; i < 20000; ++i) {
+            const std::int64_t x = pick(rng);
+            const std::int64_t y = pick(rng);
+            const Decimal a = Decimal::fromUnits(x);
+            const Decimal b = Decimal::fromUnits(y);
+            const Int128 product = reference<mode>(Int128(x) * y, one);
+            if (fits<Decimal>(product)) {
+                agree &= (a * b).units() == product;
+            }
+            if (y != 0) {
+                const Int128 quotient = reference<mode>(x * one, y);
+                if (fits<Decimal>(quotient)) {
+                    agree &= (a / b).units() == quotient;
+                }
+            }
+            if (fits<Decimal>(Int128(x) + y) && fits<Decimal>(Int128(x) - y)) {
+                agree &= (a + b).units() == Int128(x) + y && (a - b).units() == Int128(x) - y;
+            }
+        }
+        check(agree, what);
+    }
+
+    template <typename Decimal>
+    bool outOfRange(const char* text) {
+        return throws<std::out_of_range>([text] { return Decimal(text); });
+    }
+
+    void testLiterals() {
+        check(Money("-12.5").toString() == "-12.50", "negative literal prints with the scale");
+        check(Money("0.07").toString() == "0.07", "leading zeros of the fraction are kept");
+        check(Money(".25").units() == 25 && Money("+3").units() == 300, "a sign and a missing integer part parse");
+        check(Decimal64<0>(42).toString() == "42", "scale 0 prints no point");
+        check(Money::fromDouble(0.1 + 0.2).units() == 30, "fromDouble rounds to the scale");
+        check(throws<std::invalid_argument>([] { return Money("1.2.3"); }), "two points are rejected");
+        check(throws<std::invalid_argument>([] { return Money("."); }), "a point without digits is rejected");
+        check(throws<std::invalid_argument>([] { return Money("12a"); }), "other characters are rejected");
+
+        // The largest values that fit, and the smallest that do not
+        check(Decimal64<0>("9223372036854775807").units() == INT64_MAX, "INT64_MAX parses");
+        check(Decimal64<0>("9223372036854775807.4").units() == INT64_MAX, "INT64_MAX.4 rounds down to INT64_MAX");
+        check(Money("92233720368547758.07").units() == INT64_MAX, "largest Money parses");
+        check(outOfRange<Decimal64<0>>("9223372036854775808"), "INT64_MAX + 1 is out of range");
+        check(outOfRange<Decimal64<0>>("9223372036854775807.5"), "INT64_MAX.5 rounds out of range");
+        check(outOfRange<Money>("92233720368547758.08"), "largest Money + 0.01 is out of range");
+        check(outOfRange<Money>("922337203685477581"), "scaling past the range is out of range");
+        check(outOfRange<Money>("100000000000000000000"), "more digits than fit are out of range");
+        // Digits that would wrap 128 bits back into range
+        check(outOfRange<Decimal128<0>>("340282366920938463463374607431768211456"), "2^128 is out of range");
+        check(outOfRange<Decimal128<0>>("3800000000000000000000000000000000000000"),
+              "a literal that wraps 128 bits is out of range");
+    }
+
+    void testCalculator() {
+        DecimalCalculator<2> money(Money("100.00"));
+        money.divide(3).multiply(3);
+        check(money.getValue().units() == 9999, "100 / 3 * 3 is 99.99");
+        check(money.toString(1) == "100.0" && money.toString(4) == "99.9900", "toString rounds and pads");
+        check(throws<std::invalid_argument>([&money] { money.divide(0); }), "division by zero throws");
+
+        BasicCalculator<Decimal128<4>> wide(1);
+        wide.multiply(Decimal128<4>("12345678901234567890.1234"));
+        check(wide.toString(4) == "12345678901234567890.1234", "Decimal128 holds 24 significant digits");
+    }
+
+    void testBatch() {
+        for (std::size_t n : {0, 1, 3, 7, 8, 9, 17, 100}) {
+            std::vector<Money> values;
+            for (std::size_t i = 0; i < n; ++i) {
+                values.push_back(Money::fromUnits(static_cast<std::int64_t>(i * 37) - 500));
+            }
+            DecimalBatch<2> batch{std::span<const Money>(values)};
+            const DecimalBatch<2> other{std::span<const Money>(values)};
+            batch.add(Money("0.30")).multiply(Money("1.19")).subtract(other).add(other).subtract(Money("0.01"));
+            bool agree = true;
+            Money total = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const Money expected =
+                    (values[i] + Money("0.30")) * Money("1.19") - values[i] + values[i] - Money("0.01");
+                agree &= batch[i] == expected;
+                total += expected;
+            }
+            check(agree, "DecimalBatch lanes match the scalar operators");
+            check(batch.sum() == total, "DecimalBatch::sum is exact");
+
+            const auto precise = batch.rescaled<4>();
+            const auto whole = batch.rescaled<0>();
+            for (std::size_t i = 0; i < n; ++i) {
+                agree &= precise[i].units() == batch[i].units() * 100 && whole[i] == batch[i].rescaled<0>();
+            }
+            check(agree, "DecimalBatch::rescaled matches BasicDecimal::rescaled");
+            if (n > 0) {
+                check(throws<std::invalid_argument>([&batch, n] { batch.divide(DecimalBatch<2>(n)); }),
+                      "DecimalBatch division by a zero lane throws");
+            }
+            check(batch.toCalculators().size() == n, "toCalculators gives one calculator per lane");
+        }
+        check(throws<std::invalid_argument>([] { DecimalBatch<2>(3).add(DecimalBatch<2>(4)); }),
+              "batches of different sizes are rejected");
+    }
+}
+
+int main() {
+    checkArithmetic<Decimal64<2, RoundingMode::HalfEven>>("Decimal64<2, HalfEven> arithmetic");
+    checkArithmetic<Decimal64<4, RoundingMode::HalfAwayFromZero>>("Decimal64<4, HalfAwayFromZero> arithmetic");
+    checkArithmetic<Decimal64<0, RoundingMode::Floor>>("Decimal64<0, Floor> arithmetic");
+    checkArithmetic<Decimal64<18, RoundingMode::TowardZero>>("Decimal64<18, TowardZero> arithmetic");
+    checkArithmetic<Decimal128<6, RoundingMode::Ceiling>>("Decimal128<6, Ceiling> arithmetic");
+    checkArithmetic<Decimal128<18, RoundingMode::HalfEven>>("Decimal128<18, HalfEven> arithmetic");
+    testLiterals();
+    testCalculator();
+    testBatch();
+    std::printf("%s: %d failure(s)\n", failures == 0 ? "passed" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file fused_evaluation_test.cpp
+ * @brief Checks where Program::Evaluation::Fused differs from Exact, and where it must not
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * Covers the cases documented on Program::Evaluation: cancellation
+ * (0.1 * 10 - 1), a product that overflows while the sum does not, the
+ * sign of an underflowing zero, and exactly representable products, where
+ * the two evaluations must agree bit for bit. Each case runs through the
+ * scalar and the bulk execute(), and the fusedMultiplyAdd kernel of every
+ * level the CPU supports (scalar, SSE2, AVX2, AVX-512) is compared with
+ * std::fma directly, so one run covers every kernel. Levels above the
+ * detected one are reported as skipped. Finally, Calculator chains are
+ * checked against Exact, which they match only when the build does not
+ * contract them into FMAs (-ffp-contract=off).
+ *
+ * Compile it with -Icpp_library together with every source file in
+ * cpp_library; tests/run_tests.sh does this and runs it once per
+ * CALCULATOR_SIMD level.
+ */
+
+#include "calculator.h"
+#include "program.h"
+#include "simd_dispatch.h"
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    using Evaluation = Program::Evaluation;
+    using MathUtils::simd::IsaLevel;
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+    // Bit-for-bit equality, with every NaN equal to every other
+    bool same(double a, double b) {
+        return std::bit_cast<std::uint64_t>(a) == std::bit_cast<std::uint64_t>(b) || (std::isnan(a) && std::isnan(b));
+    }
+
+    Program multiplyThen(double a, OpCode next, double b) {
+        Program program;
+        program.append(OpCode::Multiply, a).append(next, b);
+        return program;
+    }
+
+    // Runs one starting value through the scalar and the bulk execute(),
+    // the bulk one in arrays of several lengths so both the vector body
+    // and the remainder loop see it
+    void checkBothPaths(const Program& program, double x, Evaluation mode, double expected, const char* what) {
+        check(same(program.execute(x, mode), expected), what);
+        for (std::size_t n : {1, 7, 8, 9, 33}) {
+            std::vector<double> in(n, x);
+            std::vector<double> out(n);
+            program.execute(in, out, mode);
+            for (double value : out) {
+                if (!same(value, expected)) {
+                    check(false, what);
+                    return;
+                }
+            }
+        }
+    }
+
+    void testCancellation() {
+        const Program program = multiplyThen(10.0, OpCode::Subtract, 1.0);
+        // 0.1 * 10 rounds to exactly 1; the true product of the double 0.1
+        // and 10 exceeds 1 by 2^-54
+        checkBothPaths(program, 0.1, Evaluation::Exact, 0.0, "0.1 * 10 - 1 is 0 when exact");
+        checkBothPaths(program, 0.1, Evaluation::Fused, 0x1p-54, "0.1 * 10 - 1 is 2^-54 when fused");
+        check(program.deviation(std::vector<double>{0.1}, Evaluation::Fused).absolute == 0x1p-54,
+              "deviation() reports the 2^-54 cancellation error");
+    }
+
+    void testOverflow() {
+        // DBL_MAX * 2 overflows, but DBL_MAX * 2 - DBL_MAX is DBL_MAX
+        const Program program = multiplyThen(2.0, OpCode::Subtract, DBL_MAX);
+        checkBothPaths(program, DBL_MAX, Evaluation::Exact, std::numeric_limits<double>::infinity(),
+                       "overflowing product gives inf when exact");
+        checkBothPaths(program, DBL_MAX, Evaluation::Fused, DBL_MAX, "overflowing product stays finite when fused");
+    }
+
+    void testSignedZero() {
+        // -1e-200 * 1e-200 underflows to -0; -0 + +0 is +0, but the exact
+        // tiny negative sum rounds to -0
+        const Program program = multiplyThen(1e-200, OpCode::Add, 0.0);
+        checkBothPaths(program, -1e-200, Evaluation::Exact, 0.0, "underflowing product plus +0 is +0 when exact");
+        checkBothPaths(program, -1e-200, Evaluation::Fused, -0.0, "underflowing product plus +0 is -0 when fused");
+    }
+
+    void testExactProducts() {
+        // A product that needs no rounding leaves nothing for fusion to keep
+        std::mt19937_64 rng(25);
+        std::uniform_real_distribution<double> value(-1e6, 1e6);
+        std::vector<double> in(1003);
+        for (double& x : in) {
+            x = value(rng);
+        }
+        std::vector<double> exact(in.size());
+        std::vector<double> fused(in.size());
+        bool agree = true;
+        for (double factor : {2.0, 0.5, -4.0, 1.0, 0x1p-20}) {
+            for (OpCode next : {OpCode::Add, OpCode::Subtract}) {
+                const Program program = multiplyThen(factor, next, value(rng));
+                program.execute(in, exact, Evaluation::Exact);
+                program.execute(in, fused, Evaluation::Fused);
+                for (std::size_t i = 0; i < in.size(); ++i) {
+                    agree &= same(exact[i], fused[i]) && same(fused[i], program.execute(in[i], Evaluation::Fused));
+                }
+            }
+        }
+        check(agree, "power-of-two products give the same bits exact and fused");
+
+        // Small integers multiply exactly too
+        const Program program = multiplyThen(3.0, OpCode::Add, 0.25);
+        checkBothPaths(program, 7.0, Evaluation::Fused, 21.25, "small integer product fused");
+        checkBothPaths(program, 7.0, Evaluation::Exact, 21.25, "small integer product exact");
+    }
+
+    void testPairing() {
+        // multiply, add, add: only the first add joins the multiply
+        Program program;
+        program.append(OpCode::Multiply, 10.0).append(OpCode::Subtract, 1.0).append(OpCode::Subtract, 0x1p-54);
+        checkBothPaths(program, 0.1, Evaluation::Fused, 0.0, "only the first add or subtract is fused");
+
+        // Without a multiply followed by an add, Fused is Exact
+        Program unpaired;
+        unpaired.append(OpCode::Add, 1.0).append(OpCode::Multiply, 10.0).append(OpCode::Divide, 3.0);
+        checkBothPaths(unpaired, 0.1, Evaluation::Fused, unpaired.execute(0.1), "chains without a pair are not fused");
+    }
+
+    void testSpecialValues() {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        const double inf = std::numeric_limits<double>::infinity();
+        const Program program = multiplyThen(2.0, OpCode::Add, 1.0);
+        for (double x : {nan, inf, -inf}) {
+            checkBothPaths(program, x, Evaluation::Fused, program.execute(x), "NaN and inf propagate as when exact");
+        }
+    }
+
+    // Inline Calculator arithmetic against the recorded chain; fails if the
+    // compiler fused a multiply and the following add
+    void testCalculatorMatchesExact() {
+        std::mt19937_64 rng(11);
+        std::uniform_real_distribution<double> value(-10.0, 10.0);
+        bool agree = true;
+        for (int i = 0; i < 100000; ++i) {
+            const double x = value(rng);
+            const double a = value(rng);
+            const double b = value(rng);
+            const double c = value(rng);
+            Program program;
+            program.append(OpCode::Multiply, a).append(OpCode::Add, b).append(OpCode::Multiply, c)
+                .append(OpCode::Subtract, a);
+            agree &= same(Calculator(x).multiply(a).add(b).multiply(c).subtract(a).getValue(), program.execute(x));
+        }
+        check(agree, "Calculator matches Exact bit for bit");
+    }
+
+    // The fusedMultiplyAdd kernel of one level against std::fma, over
+    // lengths that exercise every vector width and remainder
+    void testKernel(IsaLevel level) {
+        const auto& kernels = MathUtils::simd::detail::bulkKernels(level);
+        if (kernels.level != level) {
+            std::printf("skipped: %s is not supported by this CPU\n", MathUtils::simd::toString(level));
+            return;
+        }
+        struct Case {
+            double x;
+            double scale;
+            double offset;
+        };
+        const Case cases[] = {
+            {0.1, 10.0, -1.0},            // cancellation
+            {DBL_MAX, 2.0, -DBL_MAX},     // overflowing product
+            {-1e-200, 1e-200, 0.0},       // signed zero
+            {7.0, 3.0, 0.25},             // exact product
+            {std::numeric_limits<double>::quiet_NaN(), 2.0, 1.0},
+            {1.0, 2.0, std::numeric_limits<double>::infinity()},
+        };
+        std::mt19937_64 rng(static_cast<unsigned>(level));
+        std::uniform_real_distribution<double> value(-100.0, 100.0);
+        bool agree = true;
+        for (const Case& c : cases) {
+            for (std::size_t n = 1; n <= 35; ++n) {
+                std::vector<double> x(n);
+                std::vector<double> out(n);
+                for (double& v : x) {
+                    v = value(rng);
+                }
+                x[rng() % n] = c.x; // the special lane at a random position
+                kernels.fusedMultiplyAdd(x.data(), c.scale, c.offset, out.data(), n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    agree &= same(out[i], std::fma(x[i], c.scale, c.offset));
+                }
+            }
+        }
+        char what[64];
+        std::snprintf(what, sizeof(what), "%s fusedMultiplyAdd matches std::fma", MathUtils::simd::toString(level));
+        check(agree, what);
+    }
+}
+
+int main() {
+    testCancellation();
+    testOverflow();
+    testSignedZero();
+    testExactProducts();
+    testPairing();
+    testSpecialValues();
+    testCalculatorMatchesExact();
+    for (IsaLevel level : {IsaLevel::Scalar, IsaLevel::SSE2, IsaLevel::AVX2, IsaLevel::AVX512}) {
+        testKernel(level);
+    }
+    std::printf("%s: %d failure(s), bulk path at %s\n", failures == 0 ? "passed" : "FAILED", failures,
+                MathUtils::simd::toString(MathUtils::simd::activeLevel()));
+    return failures == 0 ? 0 : 1;
+}
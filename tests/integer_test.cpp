@@ -0,0 +1,140 @@
+/**
+ * @file integer_test.cpp
+ * @brief Checks BasicInteger, the integer calculators and IntegerBatch
+ * @author Your Name
+ * @version 1.0.0
+ * @date 2026-10-16
+ *
+ * The overflow rules are checked at compile time on the edges of the
+ * range. IntegerBatch, whose add and subtract run on the int64 kernels
+ * of the active SIMD level, is compared lane by lane with the scalar
+ * BasicInteger operators in all three overflow modes, on operands drawn
+ * close to INT64_MIN and INT64_MAX; tests/run_tests.sh runs it at every
+ * level.
+ */
+
+#include "integer.h"
+#include "integer_batch.h"
+#include "integer_calculator.h"
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    using namespace MathUtils;
+
+    int failures = 0;
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++failures;
+        }
+    }
+
+    template <typename Function>
+    bool throwsInvalidArgument(Function function) {
+        try {
+            function();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+
+    static_assert(sizeof(SaturatingInt64) == 8 && sizeof(WrappingInt64) == 8);
+    static_assert((SaturatingInt64(INT64_MAX - 1) + 5).value() == INT64_MAX);
+    static_assert((SaturatingInt64(INT64_MIN + 1) - 5).value() == INT64_MIN);
+    static_assert((SaturatingInt64(INT64_MAX) * -2).value() == INT64_MIN);
+    static_assert((SaturatingInt64(INT64_MIN) / -1).value() == INT64_MAX);
+    static_assert((-SaturatingInt64(INT64_MIN)).value() == INT64_MAX);
+    static_assert((SaturatingInt32(INT32_MAX) + 1).value() == INT32_MAX);
+    static_assert((WrappingInt64(INT64_MAX) + 1).value() == INT64_MIN);
+    static_assert((CheckedInt64(INT64_MAX) * 2 - 1).overflowed());
+    static_assert(!(CheckedInt64(INT64_MAX) - 1).overflowed());
+
+    // Values next to the ends of the range, small values and random widths
+    std::int64_t pick(std::mt19937_64& rng) {
+        switch (rng() % 6) {
+        case 0:
+            return INT64_MAX - static_cast<std::int64_t>(rng() % 5);
+        case 1:
+            return INT64_MIN + static_cast<std::int64_t>(rng() % 5);
+        case 2:
+            return static_cast<std::int64_t>(rng() % 2000) - 1000;
+        case 3:
+            return static_cast<std::int64_t>(rng()) >> (rng() % 64);
+        default:
+            return static_cast<std::int64_t>(rng());
+        }
+    }
+
+    template <OverflowMode Mode>
+    void checkBatch(const char* what) {
+        using Value = BasicInteger<std::int64_t, Mode>;
+        std::mt19937_64 rng(23);
+        bool agree = true;
+        for (std::size_t n : {0, 1, 2, 3, 5, 8, 13, 64, 65, 130, 301}) {
+            std::vector<std::int64_t> a(n);
+            std::vector<std::int64_t> b(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = pick(rng);
+                b[i] = pick(rng);
+            }
+            IntegerBatch<Mode> batch{std::span<const std::int64_t>(a)};
+            const IntegerBatch<Mode> other{std::span<const std::int64_t>(b)};
+            std::vector<Value> expected(a.begin(), a.end());
+            const Value scalar = pick(rng);
+            const Value factor = static_cast<std::int64_t>(rng() % 7) - 3;
+
+            batch.add(other).subtract(scalar).add(scalar).subtract(other).multiply(factor).divide(Value(-1));
+            for (std::size_t i = 0; i < n; ++i) {
+                expected[i] = ((expected[i] + Value(b[i]) - scalar + scalar - Value(b[i])) * factor) / Value(-1);
+                agree &= batch[i].value() == expected[i].value();
+                if constexpr (Mode == OverflowMode::Checked) {
+                    agree &= batch[i].overflowed() == expected[i].overflowed();
+                }
+            }
+            check(batch.toCalculators().size() == n, "toCalculators gives one calculator per lane");
+            if (n > 0) {
+                check(throwsInvalidArgument([&batch, n] { batch.divide(IntegerBatch<Mode>(n)); }),
+                      "IntegerBatch division by a zero lane throws");
+            }
+        }
+        check(agree, what);
+    }
+
+    void testCalculators() {
+        CheckedIntegerCalculator checked(INT64_MAX);
+        checked.add(1).subtract(1);
+        check(checked.hasError() && !checked.result() && checked.result().error() == MathError::Overflow,
+              "checked overflow is reported even after it is undone");
+        check(checked.toString() == "overflow", "an overflowed checked value prints as overflow");
+        checked.clearError();
+        check(!checked.hasError() && checked.getValue().value() == INT64_MAX, "clearError keeps the wrapped value");
+
+        SaturatingIntegerCalculator saturating(INT64_MAX);
+        saturating.add(10).divide(2);
+        check(saturating.getValue().value() == INT64_MAX / 2, "saturating add clamps before the division");
+        check(saturating.toString(0) == "4611686018427387903", "integers print without a fraction");
+
+        WrappingIntegerCalculator wrapping(INT64_MIN);
+        wrapping.subtract(1);
+        check(wrapping.getValue().value() == INT64_MAX && !wrapping.hasError(), "wrapping subtract wraps silently");
+        check(throwsInvalidArgument([&wrapping] { wrapping.divide(0); }), "integer division by zero throws");
+    }
+}
+
+int main() {
+    checkBatch<OverflowMode::Wrapping>("IntegerBatch<Wrapping> matches WrappingInt64");
+    checkBatch<OverflowMode::Saturating>("IntegerBatch<Saturating> matches SaturatingInt64");
+    checkBatch<OverflowMode::Checked>("IntegerBatch<Checked> matches CheckedInt64, flags included");
+    testCalculators();
+    using Batch = IntegerBatch<OverflowMode::Wrapping>;
+    check(throwsInvalidArgument([] { Batch(3).add(Batch(4)); }), "batches of different sizes are rejected");
+    std::printf("%s: %d failure(s)\n", failures == 0 ? "passed" : "FAILED", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Builds every test program against the library and runs each one at every
+# SIMD level this CPU supports, then once more with the library header-only.
+#
+#   tests/run_tests.sh [build directory, default _test_build]
+#
+# CXX and CXXFLAGS are honoured; the exit status is nonzero if any run failed.
+# -ffp-contract=off is always appended: Calculator matches a recorded Program
+# bit for bit only when multiply-add chains are not contracted into FMAs.
+set -u
+
+root=$(cd "$(dirname "$0")/.." && pwd)
+build=${1:-_test_build}
+cxx=${CXX:-g++}
+flags="${CXXFLAGS:--O2} -ffp-contract=off"
+mkdir -p "$build"
+
+failed=0
+for test in "$root"/tests/*.cpp; do
+    name=$(basename "$test" .cpp)
+    echo "== $name"
+    if ! $cxx -std=c++23 $flags -pthread -I"$root/cpp_library" "$test" "$root"/cpp_library/*.cpp \
+        -o "$build/$name"; then
+        failed=1
+        continue
+    fi
+    for level in scalar sse2 avx2 avx512; do
+        printf '%s: ' "$level"
+        CALCULATOR_SIMD=$level "$build/$name" || failed=1
+    done
+    printf 'header-only: '
+    if $cxx -std=c++23 $flags -pthread -DCALCULATOR_HEADER_ONLY -I"$root/cpp_library" "$test" \
+        "$root"/cpp_library/*.cpp -o "$build/$name-header-only"; then
+        "$build/$name-header-only" || failed=1
+    else
+        failed=1
+    fi
+done
+exit $failed